@@ -17,45 +17,52 @@ uint32_t get_player_char_for_dir(TxVector dir) {
     return 0;
 }
 
-int main(void) {
-    tx_prepare_terminal();
+static TxVector pos;
+static uint32_t p_char;
 
-    TxVector pos = {tx_get_screen_width() / 2, tx_get_screen_height() / 2, 0};
-    TxVector dir = {0, -1, 0};
-    uint32_t p_char = get_player_char_for_dir(dir);
+static bool update(float dt) {
+    if (tx_is_key_pressed(TxKeyCode_ESC)) {
+        return false;
+    }
 
-    for (;;) {
-        tx_poll_events();
-        if (tx_is_key_pressed(TxKeyCode_ESC)) {
-            break;
-        }
+    TxVector dir = {0};
+    if (tx_is_key_held('w')) dir.y -= 1.f;
+    if (tx_is_key_held('a')) dir.x -= 1.f;
+    if (tx_is_key_held('s')) dir.y += 1.f;
+    if (tx_is_key_held('d')) dir.x += 1.f;
 
-        dir = (TxVector){0};
-        if (tx_is_key_held('w')) dir.y -= 1.f;
-        if (tx_is_key_held('a')) dir.x -= 1.f;
-        if (tx_is_key_held('s')) dir.y += 1.f;
-        if (tx_is_key_held('d')) dir.x += 1.f;
+    uint32_t pc = get_player_char_for_dir(dir);
+    if (pc != 0) p_char = pc;
 
-        uint32_t pc = get_player_char_for_dir(dir);
-        if (pc != 0) p_char = pc;
+    // Cells per second. Cells are about twice as tall as they are wide
+    TxVector speed = {20.f * dt, 10.8f * dt, 1.f};
 
-        TxVector np = TxVector_add(pos, TxVector_mul(dir, (TxVector){0.125f, 0.0675f, 1.f}));
-        if (np.x >= 0 && np.x <= tx_get_screen_width() &&
-            np.y >= 0 && np.y <= tx_get_screen_height())
-        {
-            pos = np;
-        }
+    TxVector np = TxVector_add(pos, TxVector_mul(dir, speed));
+    if (np.x >= 0 && np.x <= tx_get_screen_width() &&
+        np.y >= 0 && np.y <= tx_get_screen_height())
+    {
+        pos = np;
+    }
 
-        tx_clear_screen();
+    return true;
+}
 
-        tx_draw_char(p_char, pos);
+static void render(float alpha) {
+    (void)alpha;
 
-        tx_render_to_terminal();
+    tx_clear_screen();
 
-        usleep(1000);
-    }
+    tx_draw_char(p_char, pos);
+}
+
+int main(void) {
+    tx_prepare_terminal();
+
+    pos    = (TxVector){tx_get_screen_width() / 2, tx_get_screen_height() / 2, 0};
+    p_char = get_player_char_for_dir((TxVector){0, -1, 0});
+
+    tx_run(update, render, 60.f);
 
     tx_restore_terminal();
     return 0;
 }
-
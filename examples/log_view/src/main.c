@@ -0,0 +1,61 @@
+#define TX_IMPLEMENTATION
+#include <temex.h>
+
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <file>\n", argv[0]);
+        return 1;
+    }
+
+    TxScrollView view;
+    if (!tx_scroll_view_open(&view, argv[1])) {
+        return 1;
+    }
+
+    tx_prepare_terminal();
+    tx_set_mouse_mode(TxMouseMode_CLICKS);
+
+    for (;;) {
+        tx_poll_events();
+        if (tx_is_key_pressed(TxKeyCode_ESC)) {
+            break;
+        }
+
+        int page = tx_get_screen_height() - 1;
+
+        tx_scroll_view_scroll(&view, tx_get_key_press_count(TxKeyCode_ARROW_DOWN) - tx_get_key_press_count(TxKeyCode_ARROW_UP));
+        tx_scroll_view_scroll(&view, page * (tx_get_key_press_count(TxKeyCode_PG_DOWN) - tx_get_key_press_count(TxKeyCode_PG_UP)));
+
+        if (tx_is_key_pressed(TxKeyCode_HOME)) tx_scroll_view_goto_line(&view, 0);
+        if (tx_is_key_pressed(TxKeyCode_END))  tx_scroll_view_goto_end(&view, page);
+
+        TxMouseEvent ev;
+        while (tx_next_mouse_event(&ev)) {
+            if (ev.kind == TxMouseEventKind_WHEEL_UP)   tx_scroll_view_scroll(&view, -3);
+            if (ev.kind == TxMouseEventKind_WHEEL_DOWN) tx_scroll_view_scroll(&view, 3);
+        }
+
+        tx_clear_screen();
+        tx_scroll_view_draw(&view, (TxRectangle){.size = {.x = tx_get_screen_width(), .y = page}});
+
+        bool complete = false;
+        uint64_t lines = tx_scroll_view_line_count(&view, &complete);
+
+        char status[128];
+        if (view.top_line_known) {
+            snprintf(status, sizeof(status), " line %llu of %llu%s ", (unsigned long long)view.top_line + 1,
+                     (unsigned long long)lines, complete ? "" : "+");
+        } else {
+            snprintf(status, sizeof(status), " end of file, %llu%s lines ", (unsigned long long)lines, complete ? "" : "+");
+        }
+        tx_draw_text(status, (TxVector){.y = page});
+
+        tx_render_to_terminal();
+    }
+
+    tx_restore_terminal();
+    tx_scroll_view_close(&view);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#define TX_IMPLEMENTATION
+#include <temex.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static uint32_t *pixels;
+static int w, h;
+static float t;
+
+static bool update(float dt) {
+    if (tx_is_key_pressed(TxKeyCode_ESC)) {
+        return false;
+    }
+
+    t += 1.5f * dt;
+    return true;
+}
+
+// Classic plasma effect, generated at twice the vertical resolution of the terminal
+static void render(float alpha) {
+    (void)alpha;
+
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            float v = sinf(x * 0.06f + t) + sinf(y * 0.08f - t) + sinf((x + y) * 0.04f + t * 0.5f);
+            uint8_t r = (uint8_t)(127.f + 127.f * sinf(v * 1.5f));
+            uint8_t g = (uint8_t)(127.f + 127.f * sinf(v * 1.5f + 2.1f));
+            uint8_t b = (uint8_t)(127.f + 127.f * sinf(v * 1.5f + 4.2f));
+            pixels[x + y * w] = (uint32_t)r << 16 | (uint32_t)g << 8 | b;
+        }
+    }
+
+    tx_draw_image(pixels, w, h, w, (TxRectangle){.size = {.x = (float)w, .y = (float)(h / 2)}});
+}
+
+int main(void) {
+    tx_prepare_terminal();
+
+    w = tx_get_screen_width();
+    h = tx_get_screen_height() * 2;
+    pixels = malloc((size_t)w * h * sizeof(*pixels));
+    if (!pixels) {
+        tx_restore_terminal();
+        return 1;
+    }
+
+    // Small changes in colour aren't worth sending
+    tx_set_image_tolerance(2);
+
+    tx_run(update, render, 30.f);
+
+    TxStats stats;
+    tx_get_stats(&stats);
+
+    free(pixels);
+    tx_restore_terminal();
+
+    fprintf(stderr, "%.1f fps, %.2fms jitter, %llu missed, %llu coalesced\n",
+            stats.fps, stats.frame_jitter * 1e3,
+            (unsigned long long)stats.missed_deadlines, (unsigned long long)stats.coalesced_frames);
+    return 0;
+}
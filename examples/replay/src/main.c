@@ -0,0 +1,33 @@
+#define TX_IMPLEMENTATION
+#include <temex.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Plays back a recording made with tx_start_recording. With a speed of 0 the frames are
+// written as fast as the terminal takes them, which makes a decent throughput benchmark.
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <recording.cast> [speed]\n", argv[0]);
+        return 1;
+    }
+
+    float speed = argc > 2 ? strtof(argv[2], NULL) : 1.f;
+
+    tx_prepare_terminal();
+
+    TxReplayStats stats = {0};
+    bool ok = tx_replay_recording(argv[1], speed, &stats);
+
+    tx_restore_terminal();
+
+    if (!ok) {
+        return 1;
+    }
+
+    fprintf(stderr, "%llu frames, %llu bytes in %.3fs (%.1f fps, %.2f MB/s)\n",
+            (unsigned long long)stats.frames, (unsigned long long)stats.bytes, stats.seconds,
+            stats.seconds > 0 ? stats.frames / stats.seconds : 0.0,
+            stats.seconds > 0 ? stats.bytes / stats.seconds / 1e6 : 0.0);
+    return 0;
+}
@@ -1,47 +1,32 @@
-#include <ctype.h>
 #define TX_IMPLEMENTATION
 #include <temex.h>
 
 int main(void) {
     tx_prepare_terminal();
 
-    #define TEXT_CAP 101
-    char text[TEXT_CAP] = {0};
-    int carrot = -1;
-
     TxRectangle text_box = {
         .pos = {.x = 10, .y = (float)(tx_get_screen_height() / 2 - 2)},
-        .size = {.x = TEXT_CAP + 1, .y = 2},
+        .size = {.x = (float)(tx_get_screen_width() - 20), .y = 2},
     };
 
+    TxTextInput input = {0};
+
+    // Only the edited cells of the input get redrawn, so the screen isn't cleared each frame
+    tx_draw_rec(text_box);
+
     for (;;) {
         tx_poll_events();
         if (tx_is_key_pressed(TxKeyCode_ESC)) {
             break;
         }
 
-        if (tx_is_key_pressed(TxKeyCode_BACKSPACE) || tx_is_key_pressed(TxKeyCode_DELETE)) {
-            if (carrot >= 0)
-                text[carrot--] = 0;
-        }
-
-        uint32_t c = 0;
-        while (tx_pressed_keys(&c)) {
-            if (!iscntrl(c)) {
-                if (carrot < TEXT_CAP - 2) {
-                    text[++carrot] = (char)c;
-                }
-            }
-        }
-
-        tx_clear_screen();
-        tx_draw_rec(text_box);
-        tx_draw_text(text, TxVector_add(text_box.pos, (TxVector){.x=1, .y=1}));
+        tx_text_input_update(&input);
+        tx_text_input_draw(&input, TxVector_add(text_box.pos, (TxVector){.x=1, .y=1}), (int)text_box.size.x - 1);
 
         tx_render_to_terminal();
     }
 
+    tx_text_input_free(&input);
     tx_restore_terminal();
     return 0;
 }
-
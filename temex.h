@@ -1,8 +1,15 @@
+// The implementation uses POSIX (clock_gettime, getline, ...), which glibc hides under a
+// strict -std=c17. This only works if no system header was included before temex.h
+#if defined(TX_IMPLEMENTATION) && !defined(__APPLE__) && !defined(_POSIX_C_SOURCE) && !defined(_GNU_SOURCE) && !defined(_DEFAULT_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #ifndef _TEMEX_H_
 #define _TEMEX_H_
 
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // +==============================================================================================+
@@ -92,10 +99,158 @@ typedef uint8_t TxKeyState;
 #define TxKeyState_HELD     0x02
 #define TxKeyState_RELEASED 0x04
 
+typedef uint8_t TxModifiers;
+#define TxModifier_SHIFT 0x01
+#define TxModifier_ALT   0x02
+#define TxModifier_CTRL  0x04
+#define TxModifier_SUPER 0x08
+
+/// Mouse reporting modes. Each mode reports everything the previous one does
+typedef enum TxMouseMode {
+    TxMouseMode_OFF,
+    TxMouseMode_CLICKS, // Presses, releases and wheel (1000)
+    TxMouseMode_DRAG,   // + Motion while a button is held (1002)
+    TxMouseMode_MOTION, // + Motion with no button held (1003)
+} TxMouseMode;
+
+typedef enum TxMouseButton {
+    TxMouseButton_NONE,
+    TxMouseButton_LEFT,
+    TxMouseButton_MIDDLE,
+    TxMouseButton_RIGHT,
+} TxMouseButton;
+
+typedef enum TxMouseEventKind {
+    TxMouseEventKind_PRESS,
+    TxMouseEventKind_RELEASE,
+    TxMouseEventKind_DRAG,
+    TxMouseEventKind_MOVE,
+    TxMouseEventKind_WHEEL_UP,
+    TxMouseEventKind_WHEEL_DOWN,
+    TxMouseEventKind_WHEEL_LEFT,
+    TxMouseEventKind_WHEEL_RIGHT,
+} TxMouseEventKind;
+
+/// Decoded mouse report. Position is in cells with the origin at the top left
+typedef struct TxMouseEvent {
+    TxMouseEventKind kind;
+    TxMouseButton    button;
+    TxModifiers      mods;
+    TxVector         pos;
+} TxMouseEvent;
+
+/// 24-bit colour made with TX_RGB, or TxColor_DEFAULT for the terminal's own colour
+typedef uint32_t TxColor;
+
+#define TX_RGB(r, g, b) ((TxColor)(0x01000000u | ((uint32_t)(r) << 16) | ((uint32_t)(g) << 8) | (uint32_t)(b)))
+#define TxColor_DEFAULT ((TxColor)0)
+
+/// How many colours the terminal can show. Colours are reduced to the nearest it supports
+typedef enum TxColorDepth {
+    TxColorDepth_NONE,
+    TxColorDepth_16,
+    TxColorDepth_256,
+    TxColorDepth_TRUE,
+} TxColorDepth;
+
+/// Kinds of commands that can be recorded into a draw list
+typedef enum TxDrawCommandKind {
+    TxDrawCommandKind_REC,
+    TxDrawCommandKind_FILL_REC,
+    TxDrawCommandKind_CHAR,
+    TxDrawCommandKind_TEXT,
+    TxDrawCommandKind_SPRITE,
+} TxDrawCommandKind;
+
+/// A recorded draw call. Text and sprite cells live in the owning list's data block
+typedef struct TxDrawCommand {
+    TxDrawCommandKind kind;
+    TxVector          pos, size;
+    uint32_t          c;          // Character for CHAR commands
+    TxColor           fg, bg;     // Colours current when the command was recorded
+    uint32_t          data, len;  // Offset and length into `TxDrawList.data` for TEXT/SPRITE
+} TxDrawCommand;
+
+/// Deferred list of draw commands rasterized in z order by `tx_submit_draw_list`.
+/// A zero-initialized list is empty, draws in the default colours and is ready to use.
+/// Recording only touches the list itself, so each thread can build its own.
+typedef struct TxDrawList {
+    TxDrawCommand *cmds;
+    uint32_t       count, cap;
+    TxColor        fg, bg;    // Colours the next recorded command is drawn with
+    char *         data;
+    uint32_t       data_len, data_cap;
+
+    // Submission order sorted by z, cached until the list changes
+    struct TxDrawSortKey { float z; uint32_t index; } *order;
+    uint32_t       order_cap;
+    bool           sorted;
+} TxDrawList;
+
+/// Single line text input backed by a gap buffer. The cursor always sits at the gap, so
+/// typing and deleting at the cursor is amortized O(1). A zero-initialized input is empty.
+typedef struct TxTextInput {
+    char *   buf;
+    uint32_t gap_start, gap_end, cap;   // Text is [0, gap_start) followed by [gap_end, cap)
+    uint32_t cursor_col;                // Columns before the cursor
+    uint32_t scroll_col, scroll_byte;   // First visible column and where it starts in the text
+    uint32_t dirty_col;                 // First column edited since the last draw
+    TxVector drawn_pos;
+    int      drawn_width;
+} TxTextInput;
+
+/// Read-only view over a memory-mapped text file. Only the lines inside the viewport are
+/// ever decoded; a background thread builds a sparse line index for jumping to line numbers.
+typedef struct TxScrollView {
+    const char *data;
+    size_t      size;
+    size_t      top;             // Byte offset of the first visible line
+    uint64_t    top_line;        // Line number of `top`, if `top_line_known`
+    bool        top_line_known;
+    uint32_t    left_col;        // First visible column
+    struct TxScrollIndex_ *index;
+} TxScrollView;
+
+/// Totals from replaying a recording
+typedef struct TxReplayStats {
+    uint64_t frames;
+    uint64_t bytes;
+    double   seconds;
+} TxReplayStats;
+
+/// Counters describing how output is keeping up with rendering
+typedef struct TxStats {
+    uint64_t frames;           // Frames sent to the terminal
+    uint64_t coalesced_frames; // Frames skipped while the terminal was still taking an earlier one
+    uint64_t bytes_written;    // Bytes the terminal has taken
+    uint64_t bytes_pending;    // Bytes of earlier frames still waiting for the terminal
+    uint64_t sink_drops;       // Times a sink couldn't keep up and had to resync
+
+    // Pacing of tx_run. fps and frame_jitter are measured over the last second
+    double   fps;
+    double   frame_jitter;     // Standard deviation of the time between frames, in seconds
+    uint64_t missed_deadlines; // Frames that started after the next one was due, in total
+} TxStats;
+
+/// Advances the simulation by a fixed `dt` seconds. Return false to stop tx_run
+typedef bool TxUpdateProc(float dt);
+
+/// Draws the current state. `alpha` is how far time has moved towards the next update,
+/// from 0 to 1, for interpolating between the last two states
+typedef void TxRenderProc(float alpha);
+
 // +==============================================================================================+
 // | Functions Declarations                                                                       |
 // +==============================================================================================+
 
+/// Serve every allocation the library makes from `mem` instead of the heap. Must be called
+/// before anything is allocated. Freed blocks are reclaimed once every block allocated after
+/// them has been freed too.
+void tx_use_arena(void *mem, size_t size);
+
+/// Get the number of bytes of the arena in use
+size_t tx_get_arena_used(void);
+
 /// Prepare terminal to act like a graphical window
 bool tx_prepare_terminal(void);
 
@@ -123,15 +278,81 @@ bool tx_is_key_held(TxKeyCode key);
 /// Test if a given key has been released
 bool tx_is_key_released(TxKeyCode key);
 
+/// Get the modifiers that were held during the most recent key event
+TxModifiers tx_get_modifiers(void);
+
+/// Get the number of press and auto-repeat events a key received this frame
+int tx_get_key_press_count(TxKeyCode key);
+
+/// Get the UTF-8 text typed or pasted this frame. The result is NUL-terminated
+const char *tx_get_text_input(int *len);
+
 /// Iterate over all keys pressed this frame
 bool tx_pressed_keys(uint32_t *c);
 
-/// Renders screen to the terminal
+/// Enable mouse reporting (SGR encoded) or disable it with TxMouseMode_OFF
+void tx_set_mouse_mode(TxMouseMode mode);
+
+/// Pop the next mouse event received this frame. Consecutive motion is coalesced
+bool tx_next_mouse_event(TxMouseEvent *ev);
+
+/// Get the last reported position of the mouse
+TxVector tx_get_mouse_pos(void);
+
+/// Test if a given mouse button is being held down
+bool tx_is_mouse_button_held(TxMouseButton button);
+
+/// Renders screen to the terminal. Only cells that changed since the last frame are sent.
+/// Never blocks: while the terminal is still taking an earlier frame the render is skipped,
+/// and its changes go out with the next frame that isn't.
 void tx_render_to_terminal(void);
 
-/// Clear the terminal screen
+/// Get counters for frames and bytes sent to the terminal
+void tx_get_stats(TxStats *stats);
+
+/// Run a frame loop until `update` returns false. `update` is called `hz` times per second
+/// of real time, with events polled before each call, falling back to fewer renders rather
+/// than a slower simulation when frames take too long. Each frame is rendered to the terminal.
+void tx_run(TxUpdateProc *update, TxRenderProc *render, float hz);
+
+/// Mirror every rendered frame to another fd, such as a socket. The frame is encoded once
+/// for all sinks. New sinks and sinks that can't keep up are sent a full frame to resync.
+/// A sink that fails with anything other than a full buffer, such as a closed socket, is removed.
+bool tx_add_sink(int fd);
+
+/// Stop mirroring frames to a sink
+void tx_remove_sink(int fd);
+
+/// Listen on a Unix socket and add every client that connects as a sink
+bool tx_listen_for_sinks(const char *path);
+
+/// Clear the terminal screen to the current colours
 void tx_clear_screen(void);
 
+/// Set the colour characters are drawn with from now on
+void tx_set_fg(TxColor color);
+
+/// Set the colour behind characters drawn from now on
+void tx_set_bg(TxColor color);
+
+/// Override the colour depth detected from COLORTERM and TERM
+void tx_set_color_depth(TxColorDepth depth);
+
+/// Get the colour depth output is reduced to
+TxColorDepth tx_get_color_depth(void);
+
+/// Dither colours that are reduced to a palette, which smooths out gradients
+void tx_set_dither(bool enabled);
+
+/// Draw 0xRRGGBB pixels scaled to fill a rectangle, two pixels per cell using `▀`.
+/// `stride` is the number of pixels from the start of one row to the next
+void tx_draw_image(const uint32_t *pixels, int w, int h, int stride, TxRectangle dst);
+
+/// Leave image cells alone when no channel of their colours changed by more than
+/// `tolerance` since the last frame rendered, so noisy video doesn't resend cells that
+/// look the same. 0 by default
+void tx_set_image_tolerance(int tolerance);
+
 /// Draw the outline of a rectangle
 void tx_draw_rec(TxRectangle rec);
 
@@ -144,6 +365,107 @@ void tx_draw_char(uint32_t c, TxVector p);
 /// Draw some text at a position
 void tx_draw_text(const char *text, TxVector pos);
 
+/// Release the memory owned by a draw list
+void tx_draw_list_free(TxDrawList *dl);
+
+/// Remove all commands from a draw list, keeping its memory and colours for reuse
+void tx_draw_list_clear(TxDrawList *dl);
+
+/// Set the colour characters are recorded with from now on
+void tx_draw_list_set_fg(TxDrawList *dl, TxColor color);
+
+/// Set the colour behind characters recorded from now on
+void tx_draw_list_set_bg(TxDrawList *dl, TxColor color);
+
+/// Record the outline of a rectangle
+void tx_draw_list_rec(TxDrawList *dl, TxRectangle rec);
+
+/// Record a filled in rectangle
+void tx_draw_list_fill_rec(TxDrawList *dl, TxRectangle rec);
+
+/// Record a character at a position
+void tx_draw_list_char(TxDrawList *dl, uint32_t c, TxVector p);
+
+/// Record some text at a position. The text is copied into the list
+void tx_draw_list_text(TxDrawList *dl, const char *text, TxVector pos);
+
+/// Record a `w` by `h` block of cells at a position. Cells that are 0 are transparent
+void tx_draw_list_sprite(TxDrawList *dl, const uint32_t *cells, int w, int h, TxVector pos);
+
+/// Append the commands of `src` to `dst`. Lists built on other threads are merged this way
+void tx_draw_list_append(TxDrawList *dst, const TxDrawList *src);
+
+/// Rasterize a draw list onto the screen back to front. Commands with equal z keep their
+/// recorded order. Bypasses the depth buffer, so it paints over earlier immediate draws.
+void tx_submit_draw_list(TxDrawList *dl);
+
+/// Release the memory owned by a text input
+void tx_text_input_free(TxTextInput *ti);
+
+/// Remove all text from a text input
+void tx_text_input_clear(TxTextInput *ti);
+
+/// Insert UTF-8 text at the cursor
+void tx_text_input_insert(TxTextInput *ti, const char *text, uint32_t len);
+
+/// Delete the character before the cursor
+void tx_text_input_delete_back(TxTextInput *ti);
+
+/// Delete the character after the cursor
+void tx_text_input_delete_forward(TxTextInput *ti);
+
+/// Move the cursor by a number of characters. Negative moves left
+void tx_text_input_move(TxTextInput *ti, int chars);
+
+/// Apply this frame's typed text and editing keys to a text input, in the order they were
+/// typed. On macOS keys and text arrive separately, so all text is applied before the keys
+void tx_text_input_update(TxTextInput *ti);
+
+/// Draw the part of a text input visible in a window `width` cells wide, scrolling to keep
+/// the cursor visible. Only cells edited since the last draw are rewritten.
+void tx_text_input_draw(TxTextInput *ti, TxVector pos, int width);
+
+/// Force the next draw to rewrite every visible cell, e.g. after clearing the screen
+void tx_text_input_invalidate(TxTextInput *ti);
+
+/// Get the length of the text in bytes
+uint32_t tx_text_input_length(const TxTextInput *ti);
+
+/// Copy the text into `dst` as a NUL-terminated string. Returns the number of bytes copied
+uint32_t tx_text_input_get(const TxTextInput *ti, char *dst, uint32_t cap);
+
+/// Map a file into a scroll view and start indexing its lines in the background
+bool tx_scroll_view_open(TxScrollView *sv, const char *path);
+
+/// Stop indexing and unmap the file
+void tx_scroll_view_close(TxScrollView *sv);
+
+/// Get the number of lines indexed so far. `complete` is set once the whole file is indexed
+uint64_t tx_scroll_view_line_count(const TxScrollView *sv, bool *complete);
+
+/// Scroll by a number of lines. Negative scrolls up
+void tx_scroll_view_scroll(TxScrollView *sv, int64_t lines);
+
+/// Jump to a line. Fails if the index hasn't reached that line yet
+bool tx_scroll_view_goto_line(TxScrollView *sv, uint64_t line);
+
+/// Jump so the last `height` lines of the file are visible. Doesn't need the index
+void tx_scroll_view_goto_end(TxScrollView *sv, int height);
+
+/// Draw the visible lines into a rectangle `size.x` columns wide and `size.y` rows tall
+void tx_scroll_view_draw(TxScrollView *sv, TxRectangle rec);
+
+/// Record every rendered frame and all input to an asciicast v2 file. The file is
+/// written by a background thread so recording adds no I/O to the frame.
+bool tx_start_recording(const char *path);
+
+/// Stop recording and flush everything recorded so far
+void tx_stop_recording(void);
+
+/// Play the output of a recording back to the terminal. A `speed` of 1 keeps the original
+/// timing, larger values play faster and 0 plays as fast as the terminal accepts it.
+bool tx_replay_recording(const char *path, float speed, TxReplayStats *stats);
+
 /// Set the minimum log level to log
 void tx_set_log_level(TxLogLevel lv);
 
@@ -155,6 +477,10 @@ void tx_log(TxLogLevel lv, const char *restrict fmt, ...);
 /// Encodes a character to UTF-8 into a buffer
 bool tx_to_utf8(uint32_t c, char buf[static 5]);
 
+/// Number of columns a character takes up in the terminal: 0 for combining marks and
+/// control characters, 2 for wide characters such as CJK and emoji, otherwise 1
+int tx_char_width(uint32_t c);
+
 TxVector TxVector_add(TxVector a, TxVector b);
 TxVector TxVector_mul(TxVector a, TxVector b);
 
@@ -168,13 +494,23 @@ TxVector TxVector_mul(TxVector a, TxVector b);
 #ifndef _TEMEX_H_IMPLEMENTATION_
 #define _TEMEX_H_IMPLEMENTATION_
 
+#include <errno.h>
 #include <fcntl.h>
 #include <math.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
 #include <termios.h>
+#include <time.h>
 #include <unistd.h>
 
 #ifdef __APPLE__
@@ -182,10 +518,30 @@ TxVector TxVector_mul(TxVector a, TxVector b);
 #include <Carbon/Carbon.h>
 #endif // __APPLE__
 
+// Allocation hooks. Define all three or none before including the implementation
+#if !defined(TX_MALLOC) && !defined(TX_REALLOC) && !defined(TX_FREE)
+#define TX_MALLOC(size)       malloc(size)
+#define TX_REALLOC(ptr, size) realloc(ptr, size)
+#define TX_FREE(ptr)          free(ptr)
+#elif !defined(TX_MALLOC) || !defined(TX_REALLOC) || !defined(TX_FREE)
+#error "TX_MALLOC, TX_REALLOC and TX_FREE must be defined together"
+#endif
+
+// Defining both gives the screen fixed storage of that size so it needs no allocation.
+// Larger terminals are clipped to it.
+#if defined(TX_MAX_WIDTH) != defined(TX_MAX_HEIGHT)
+#error "TX_MAX_WIDTH and TX_MAX_HEIGHT must be defined together"
+#endif
+
 // +==============================================================================================+
 // | Forward Declarations                                                                         |
 // +==============================================================================================+
 
+struct TxRecorder_;
+
+static void *    tx_alloc_(size_t size);
+static void *    tx_realloc_(void *ptr, size_t size);
+static void      tx_free_(void *ptr);
 static bool      tx_enable_raw_mode_(void);
 static void      tx_disable_raw_mode_(void);
 static void      tx_enter_alt_screen_(void);
@@ -195,44 +551,394 @@ static void      tx_show_cursor_(void);
 static bool      tx_get_screen_size_(uint16_t *x, uint16_t *y);
 static TxVector  tx_round_pos_(TxVector p);
 static int       tx_pos_to_idx_(TxVector p);
-static void      tx_set_cell_(int idx, uint32_t c, float z);
+static int       tx_set_cell_(int idx, uint32_t c, float z);
+static int       tx_put_cell_(int idx, uint32_t c);
 static int       tx_codepoint_length_(uint32_t c);
 static void      tx_move_cursor_to_origin_(void);
-static TxKeyCode tx_convert_to_keycode(int code);
+static bool      tx_out_reserve_(size_t len);
+static void      tx_out_append_(const char *s, size_t len);
+static void      tx_out_flush_(void);
+static void      tx_out_cell_(int idx);
+static void      tx_out_colors_(TxColor fg, TxColor bg, int x, int y);
+static int       tx_sgr_color_(char *buf, TxColor pen, bool bg);
+static uint32_t  tx_reduce_color_(TxColor c, int x, int y);
+static void      tx_build_color_lut_(void);
+static void      tx_out_reset_colors_(void);
+static void      tx_pack_half_blocks_(TxColor *restrict fg, TxColor *restrict bg, const uint32_t *restrict top, const uint32_t *restrict bottom, int n);
+static void      tx_pack_half_blocks_mapped_(TxColor *restrict fg, TxColor *restrict bg, const uint32_t *restrict top, const uint32_t *restrict bottom, const int *restrict xmap, int n);
+static TxColor   tx_keep_close_color_(TxColor old, TxColor c, int tolerance);
+static int       tx_color_dist_(int r0, int g0, int b0, int r1, int g1, int b1);
+static TxColorDepth tx_detect_color_depth_(void);
+static void      tx_encode_keyframe_(void);
+static void      tx_encode_delta_(void);
+static void      tx_accept_sinks_(void);
+static bool      tx_sink_write_(int fd, const char *buf, size_t len);
+static bool      tx_sink_failed_(int i);
+static ssize_t   tx_write_no_sigpipe_(int fd, const char *buf, size_t len);
+static bool      tx_write_all_(int fd, const char *buf, size_t len);
+static size_t    tx_write_some_(int fd, const char *buf, size_t len);
+static void      tx_out_send_(const char *buf, size_t len);
+static void      tx_drain_pending_(bool block);
+static bool      tx_output_backlogged_(void);
+static void      tx_record_(char kind, const char *data, size_t len);
+static void      tx_recorder_put_(struct TxRecorder_ *rec, const void *data, size_t len);
+static void      tx_recorder_get_(struct TxRecorder_ *rec, void *data, size_t len);
+static void *    tx_recorder_run_(void *arg);
+static void      tx_write_json_string_(FILE *f, const char *s, size_t len);
+static size_t    tx_parse_json_string_(const char *s, char *out);
+static double    tx_time_now_(void);
+static void      tx_sleep_until_(double t);
+static void      tx_read_input_(void);
+static int       tx_decode_input_(const uint8_t *buf, int len);
+static int       tx_decode_csi_(const uint8_t *buf, int len);
+static int       tx_parse_csi_params_(const char *params, int fields[3][3]);
+static int       tx_convert_kitty_keycode_(int code);
+static void      tx_decode_mouse_(const char *params, char final);
+static void      tx_push_mouse_event_(TxMouseEvent ev);
+static void      tx_key_event_(int key, int type, TxModifiers mods);
+static void      tx_push_text_(uint32_t c);
+static int       tx_utf8_decode_(const char *s, int len, uint32_t *c);
+static uint32_t  tx_text_input_byte_(const TxTextInput *ti, uint32_t i);
+static uint32_t  tx_text_input_next_(const TxTextInput *ti, uint32_t i, uint32_t *c);
+static uint32_t  tx_text_input_prev_(const TxTextInput *ti, uint32_t i);
+static void      tx_text_input_apply_key_(TxTextInput *ti, int key);
+static void      tx_text_input_move_gap_(TxTextInput *ti, uint32_t i);
+static bool      tx_text_input_reserve_(TxTextInput *ti, uint32_t len);
+static void *    tx_scroll_index_run_(void *arg);
+static size_t    tx_scroll_next_line_(const TxScrollView *sv, size_t o);
+static size_t    tx_scroll_prev_line_(const TxScrollView *sv, size_t o);
+static TxDrawCommand *tx_draw_list_push_(TxDrawList *dl, TxDrawCommandKind kind, TxVector pos);
+static bool      tx_draw_list_reserve_data_(TxDrawList *dl, uint32_t len);
+static int       tx_compare_sort_keys_(const void *a, const void *b);
+static void      tx_raster_rec_(TxRectangle rec, const uint32_t *palette, bool fill);
+static void      tx_plot_(uint32_t c, int x, int y);
 
 #ifdef __APPLE__
+static TxKeyCode tx_convert_to_keycode(int code);
 static bool tx_macos_enable_event_tap(void);
 static CGEventRef tx_macos_CGEvent_callback(CGEventTapProxy proxy, CGEventType type, CGEventRef event, void* refcon);
 #endif // __APPLE__
 
+#ifndef TX_INPUT_BUFFER_SIZE
+#define TX_INPUT_BUFFER_SIZE 4096
+#endif
+
+#ifndef TX_MAX_MOUSE_EVENTS
+#define TX_MAX_MOUSE_EVENTS 64
+#endif
+
+#ifndef TX_MAX_KEY_LOG
+#define TX_MAX_KEY_LOG 256
+#endif
+
+#ifndef TX_TEXT_INPUT_SIZE
+#define TX_TEXT_INPUT_SIZE 16384
+#endif
+
+// Lines between line index entries. Doubled for big files so the index never exceeds
+// TX_SCROLL_INDEX_MAX_ENTRIES offsets, however many lines the file has.
+#ifndef TX_SCROLL_INDEX_STRIDE
+#define TX_SCROLL_INDEX_STRIDE 256
+#endif
+
+#ifndef TX_SCROLL_INDEX_MAX_ENTRIES
+#define TX_SCROLL_INDEX_MAX_ENTRIES (1 << 20)
+#endif
+
+#define TX_SCROLL_INDEX_CHUNK_ 4096
+
+// Screen cell covered by the right half of the wide character to its left
+#define TX_WIDE_TAIL_ 0xFFFFFFFFu
+
+// Most bytes one cell can take to encode, including the colour change before it
+#define TX_CELL_MAX_BYTES_ 48
+
+#ifdef TX_MAX_WIDTH
+#define TX_OUT_STORAGE_SIZE_ (TX_MAX_WIDTH * TX_MAX_HEIGHT * 4 + TX_MAX_HEIGHT * 2 + 16 * TX_CELL_MAX_BYTES_)
+#endif
+
+// Palette colours are looked up by the top 5 bits of each channel
+#define TX_COLOR_LUT_BITS_ 5
+
+// Arena blocks are prefixed with their size, so they can be grown, and the offset of the
+// block before them, so freeing the latest block can give back earlier freed ones as well
+#define TX_ARENA_HEADER_ 16
+#define TX_ARENA_NONE_   SIZE_MAX
+#define TX_ARENA_FREED_  SIZE_MAX
+
+struct TxArenaHeader_ { size_t size, prev; };
+
+#ifndef TX_MAX_CATCH_UP_STEPS
+#define TX_MAX_CATCH_UP_STEPS 5 // Updates run in one frame before falling behind is accepted
+#endif
+
+#ifndef TX_OUTPUT_QUEUE_LIMIT
+#define TX_OUTPUT_QUEUE_LIMIT 16384 // Bytes queued in the tty before frames are skipped
+#endif
+
+#ifndef TX_MAX_SINKS
+#define TX_MAX_SINKS 32
+#endif
+
+#ifndef TX_RECORD_BUFFER_SIZE
+#define TX_RECORD_BUFFER_SIZE (4 << 20)
+#endif
+
+// Seconds without a repeat before a key is considered released, for terminals that
+// don't report releases. The first repeat arrives after the (longer) autorepeat delay.
+#ifndef TX_KEY_REPEAT_DELAY
+#define TX_KEY_REPEAT_DELAY 0.55
+#endif
+
+#ifndef TX_KEY_REPEAT_INTERVAL
+#define TX_KEY_REPEAT_INTERVAL 0.1
+#endif
+
+// Kitty progressive keyboard enhancement flags
+#define TX_KITTY_DISAMBIGUATE_  0x01
+#define TX_KITTY_REPORT_EVENTS_ 0x02
+#define TX_KITTY_REPORT_ALL_    0x08
+#define TX_KITTY_REPORT_TEXT_   0x10
+
 struct TxState_ {
     TxLogLevel     log_level;
     uint16_t       screen_width, screen_height;
     uint32_t *     screen;
+    uint32_t *     front;          // What the terminal is showing, diffed against `screen`
+    TxColor *      fg, *bg;
+    TxColor *      front_fg, *front_bg;
     float *        depth_buffer;
+    bool           keyframe;       // Next frame repaints every cell
+#ifdef TX_MAX_WIDTH
+    uint32_t       screen_storage[TX_MAX_WIDTH * TX_MAX_HEIGHT];
+    uint32_t       front_storage[TX_MAX_WIDTH * TX_MAX_HEIGHT];
+    TxColor        color_storage[4][TX_MAX_WIDTH * TX_MAX_HEIGHT];
+    float          depth_storage[TX_MAX_WIDTH * TX_MAX_HEIGHT];
+    int            image_xmap_storage[TX_MAX_WIDTH];
+#endif
+
+    // Source column for each screen column of the image being drawn
+    int *          image_xmap;
+    int            image_tolerance;
+
+    // Colours for drawing, and what the terminal's SGR state was last set to
+    TxColor        draw_fg, draw_bg;
+    uint32_t       pen_fg, pen_bg;
+    TxColorDepth   color_depth;
+    bool           color_depth_set;
+    bool           dither;
+    uint8_t        color_lut[1 << (3 * TX_COLOR_LUT_BITS_)];
+
+    // Bytes of the frame being encoded, flushed to the terminal in one write
+    char *         out;
+    size_t         out_len, out_cap;
+#ifdef TX_MAX_WIDTH
+    char           out_storage[TX_OUT_STORAGE_SIZE_];
+#endif
+
+    // Bytes the terminal hasn't taken yet. Later output queues behind them
+    char *         pending;
+    size_t         pending_len, pending_cap;
+#ifdef TX_MAX_WIDTH
+    char           pending_storage[TX_OUT_STORAGE_SIZE_];
+#endif
+    TxStats        stats;
+
+    struct TxRecorder_ *recorder;
+
+    // Extra outputs that mirror the terminal. Unsynced sinks wait for a keyframe
+    struct TxSink_ { int fd; bool synced, resync_ok, owned; } sinks[TX_MAX_SINKS];
+    int            sink_count;
+    int            sink_listener;
+    char           sink_path[108];
+    bool           out_to_sinks;   // Flushes go to unsynced sinks rather than the terminal
+
+    // Caller provided memory that replaces the heap when set
+    char *         arena;
+    size_t         arena_size, arena_used, arena_last;
     struct termios default_termios;
     TxKeyState     keys[TxKeyCode_COUNT];
+    double         key_last_seen[TxKeyCode_COUNT];
+    bool           key_repeating[TxKeyCode_COUNT];
+    uint8_t        key_presses[TxKeyCode_COUNT];
+
+    // Text editing keys pressed this frame in order, each with how much text came before it
+    struct TxKeyLogEntry_ { uint16_t key, text_len; } key_log[TX_MAX_KEY_LOG];
+    int            key_log_count;
+    TxModifiers    modifiers;
+    int            kitty_flags; // Flags the terminal acknowledged, 0 if unsupported
+
+    // Raw bytes read from stdin that don't yet form a complete sequence
+    uint8_t        input[TX_INPUT_BUFFER_SIZE];
+    int            input_len;
+
+    // Text typed or pasted this frame
+    char           text[TX_TEXT_INPUT_SIZE + 1];
+    int            text_len;
+
+    TxMouseMode    mouse_mode;
+    TxMouseEvent   mouse_events[TX_MAX_MOUSE_EVENTS];
+    int            mouse_event_count, mouse_event_next;
+    TxVector       mouse_pos;
+    uint8_t        mouse_buttons;
 } TX_;
 
+/// Sparse line index shared with the indexing thread. Entry `k` is the offset of line
+/// `k * stride`; entries live in fixed chunks so readers never see them move.
+struct TxScrollIndex_ {
+    const char *     data;
+    size_t           size;
+    int              fd;
+    uint64_t         stride;
+    uint64_t *       chunks[TX_SCROLL_INDEX_MAX_ENTRIES / TX_SCROLL_INDEX_CHUNK_];
+    _Atomic uint64_t entries;
+    _Atomic uint64_t lines;
+    atomic_bool      done;
+    atomic_bool      stop;
+    pthread_t        thread;
+    bool             started;
+};
+
+/// Recording state. Frames and input are copied into a ring of `[time, len, kind, bytes]`
+/// records that a background thread drains into the file.
+struct TxRecorder_ {
+    FILE *          file;
+    double          start;
+    pthread_t       thread;
+    pthread_mutex_t lock;
+    pthread_cond_t  wake;
+    char *          ring;
+    size_t          cap, head, used;
+    uint64_t        dropped;
+    bool            stop;
+};
+
+// xterm's defaults for the 16 system colours
+static const uint8_t tx_ansi_palette_[16][3] = {
+    {  0,   0,   0}, {205,   0,   0}, {  0, 205,   0}, {205, 205,   0},
+    {  0,   0, 238}, {205,   0, 205}, {  0, 205, 205}, {229, 229, 229},
+    {127, 127, 127}, {255,   0,   0}, {  0, 255,   0}, {255, 255,   0},
+    { 92,  92, 255}, {255,   0, 255}, {  0, 255, 255}, {255, 255, 255},
+};
+
+// Levels of each channel in the 6x6x6 colour cube of the 256 colour palette
+static const uint8_t tx_cube_levels_[6] = {0, 95, 135, 175, 215, 255};
+
+static const uint8_t tx_bayer_4x4_[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+};
+
+static const uint32_t tx_rec_palette_[] = {
+    0x2500, // ─ - Horizontal
+    0x2502, // │ - Vertical
+    0x250C, // ┌ - Top Left
+    0x2510, // ┐ - Top Right
+    0x2514, // └ - Bottom Left
+    0x2518  // ┘ - Bottom Right
+};
+
+static const uint32_t tx_fill_palette_[] = {
+    0x2584, // ▄ - Top Horizontal
+    0x2580, // ▀ - Bottom Horizontal
+    0x258C, // ▌ - Right Vertical
+    0x2590, // ▐ - Left Vertical
+    0x2588, // █ - Fill
+    0x2597, // ▗ - Top Left Corner
+    0x2596, // ▖ - Top Right Corner
+    0x259D, // ▝ - Bottom Left Corner
+    0x2598, // ▘ - Bottom Right Corner
+};
+
 bool tx_prepare_terminal(void) {
     // Get screen information
     if (!tx_get_screen_size_(&TX_.screen_width, &TX_.screen_height)) {
         return false;
     }
 
+#ifdef TX_MAX_WIDTH
+    if (TX_.screen_width > TX_MAX_WIDTH)   TX_.screen_width  = TX_MAX_WIDTH;
+    if (TX_.screen_height > TX_MAX_HEIGHT) TX_.screen_height = TX_MAX_HEIGHT;
+
+    TX_.screen       = TX_.screen_storage;
+    TX_.front        = TX_.front_storage;
+    TX_.fg           = TX_.color_storage[0];
+    TX_.bg           = TX_.color_storage[1];
+    TX_.front_fg     = TX_.color_storage[2];
+    TX_.front_bg     = TX_.color_storage[3];
+    TX_.depth_buffer = TX_.depth_storage;
+    TX_.image_xmap   = TX_.image_xmap_storage;
+#else
     // Allocate buffers
-    TX_.screen = calloc(TX_.screen_width * TX_.screen_height, sizeof(*TX_.screen));
+    TX_.screen = tx_alloc_(TX_.screen_width * TX_.screen_height * sizeof(*TX_.screen));
     if (!TX_.screen) {
         tx_error("Failed to allocate screen");
         return false;
     }
 
-    TX_.depth_buffer = calloc(TX_.screen_width * TX_.screen_height, sizeof(*TX_.depth_buffer));
+    TX_.front = tx_alloc_(TX_.screen_width * TX_.screen_height * sizeof(*TX_.front));
+    if (!TX_.front) {
+        tx_error("Failed to allocate front buffer");
+        return false;
+    }
+
+    TxColor **colors[] = {&TX_.fg, &TX_.bg, &TX_.front_fg, &TX_.front_bg};
+    for (size_t i = 0; i < sizeof(colors) / sizeof(*colors); i++) {
+        *colors[i] = tx_alloc_(TX_.screen_width * TX_.screen_height * sizeof(TxColor));
+        if (!*colors[i]) {
+            tx_error("Failed to allocate colours");
+            return false;
+        }
+    }
+
+    TX_.depth_buffer = tx_alloc_(TX_.screen_width * TX_.screen_height * sizeof(*TX_.depth_buffer));
     if (!TX_.depth_buffer) {
         tx_error("Failed to allocate depth buffer");
         return false;
     }
 
+    TX_.image_xmap = tx_alloc_(TX_.screen_width * sizeof(*TX_.image_xmap));
+    if (!TX_.image_xmap) {
+        tx_error("Failed to allocate image column map");
+        return false;
+    }
+#endif
+
+    memset(TX_.screen, 0, TX_.screen_width * TX_.screen_height * sizeof(*TX_.screen));
+    memset(TX_.front, 0, TX_.screen_width * TX_.screen_height * sizeof(*TX_.front));
+    memset(TX_.fg, 0, TX_.screen_width * TX_.screen_height * sizeof(TxColor));
+    memset(TX_.bg, 0, TX_.screen_width * TX_.screen_height * sizeof(TxColor));
+    memset(TX_.front_fg, 0, TX_.screen_width * TX_.screen_height * sizeof(TxColor));
+    memset(TX_.front_bg, 0, TX_.screen_width * TX_.screen_height * sizeof(TxColor));
+
+    if (!TX_.color_depth_set) TX_.color_depth = tx_detect_color_depth_();
+    tx_build_color_lut_();
+
+    TX_.keyframe      = true;
+    TX_.sink_listener = -1;
+    memset(TX_.depth_buffer, 0, TX_.screen_width * TX_.screen_height * sizeof(*TX_.depth_buffer));
+
+#ifdef TX_MAX_WIDTH
+    TX_.out     = TX_.out_storage;
+    TX_.out_cap = sizeof(TX_.out_storage);
+
+    TX_.pending     = TX_.pending_storage;
+    TX_.pending_cap = sizeof(TX_.pending_storage);
+#else
+    // Enough for a frame of 3-byte characters; grows on demand
+    TX_.out_cap = (size_t)TX_.screen_width * TX_.screen_height * 3 + TX_.screen_height * 2 + 16;
+    TX_.out     = tx_alloc_(TX_.out_cap);
+    if (!TX_.out) {
+        tx_error("Failed to allocate output buffer");
+        return false;
+    }
+#endif
+    TX_.out_len     = 0;
+    TX_.pending_len = 0;
+    TX_.stats       = (TxStats){0};
+
     if (!tx_enable_raw_mode_()) {
         return false;
     }
@@ -241,14 +947,43 @@ bool tx_prepare_terminal(void) {
 
 #ifdef __APPLE__
     tx_macos_enable_event_tap();
+#else
+    // Request press/repeat/release events and query whether the terminal understood
+    tx_drain_pending_(true);
+    printf("\x1b[>%du\x1b[?u", TX_KITTY_DISAMBIGUATE_ | TX_KITTY_REPORT_EVENTS_ | TX_KITTY_REPORT_ALL_ | TX_KITTY_REPORT_TEXT_);
+    fflush(stdout);
 #endif
 
     return true;
 }
 
 void tx_restore_terminal(void) {
-    free(TX_.screen);
-    free(TX_.depth_buffer);
+    tx_stop_recording();
+    tx_drain_pending_(true);
+
+    for (int i = TX_.sink_count - 1; i >= 0; i--) {
+        if (TX_.sinks[i].owned) close(TX_.sinks[i].fd);
+    }
+    TX_.sink_count = 0;
+
+    if (TX_.sink_listener >= 0) {
+        close(TX_.sink_listener);
+        unlink(TX_.sink_path);
+        TX_.sink_listener = -1;
+    }
+
+#ifndef TX_MAX_WIDTH
+    tx_free_(TX_.pending);
+    tx_free_(TX_.out);
+    tx_free_(TX_.image_xmap);
+    tx_free_(TX_.depth_buffer);
+    tx_free_(TX_.front_bg);
+    tx_free_(TX_.front_fg);
+    tx_free_(TX_.bg);
+    tx_free_(TX_.fg);
+    tx_free_(TX_.front);
+    tx_free_(TX_.screen);
+#endif
 
 #ifdef __APPLE__
     CFRunLoopStop(CFRunLoopGetCurrent());
@@ -263,6 +998,17 @@ void tx_restore_terminal(void) {
 #endif
 }
 
+void tx_use_arena(void *mem, size_t size) {
+    TX_.arena      = mem;
+    TX_.arena_size = size;
+    TX_.arena_used = 0;
+    TX_.arena_last = TX_ARENA_NONE_;
+}
+
+size_t tx_get_arena_used(void) {
+    return TX_.arena_used;
+}
+
 uint16_t tx_get_screen_width(void) {
     return TX_.screen_width;
 }
@@ -272,38 +1018,61 @@ uint16_t tx_get_screen_height(void) {
 }
 
 void tx_poll_events(void) {
+    TX_.mouse_event_count = 0;
+    TX_.mouse_event_next  = 0;
+    TX_.text_len          = 0;
+    TX_.text[0]           = 0;
+    memset(TX_.key_presses, 0, sizeof(TX_.key_presses));
+    TX_.key_log_count = 0;
+
+    for (int i = 0; i < TxKeyCode_COUNT; i++) {
+        if      (TX_.keys[i] & TxKeyState_RELEASED) TX_.keys[i] = 0;
+        else if (TX_.keys[i] & TxKeyState_PRESSED)  TX_.keys[i] = TxKeyState_HELD;
+    }
+
 #ifdef _WIN32
     #error "Polling events on Windows not yet supported"
-#elif __linux__
-    #error "Polling events on Linux not yet supported"
 #elif __APPLE__
-    for (int i = 0; i < TxKeyCode_COUNT; i++) {
-        if (TX_.keys[i] & TxKeyState_PRESSED)  TX_.keys[i] = TxKeyState_HELD;
-        if (TX_.keys[i] & TxKeyState_RELEASED) TX_.keys[i] = 0;
-    }
     CFRunLoopRunResult result = CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0.0, TRUE);
     (void)result; // TODO: Handle the result in case of failure
+
+    // Keys come from the event tap but mouse reports still arrive on stdin
+    tx_read_input_();
 #else
-    bool keys[256] = {0};
+    tx_read_input_();
 
-    char c = 0;
-    while (read(STDIN_FILENO, &c, 1) == 1) {
-        keys[(int)c] = true;
-    }
+    // Without release events a key counts as held until the terminal stops repeating it
+    if (!(TX_.kitty_flags & TX_KITTY_REPORT_EVENTS_)) {
+        double now = tx_time_now_();
+        for (int i = 0; i < TxKeyCode_COUNT; i++) {
+            if (!(TX_.keys[i] & TxKeyState_HELD)) continue;
 
-    for (int i = 0; i < 256; i++) {
-        if (keys[i] == false) {
-            if (TX_.keys[i] & TxKeyState_HELD) TX_.keys[i] = TxKeyState_RELEASED;
-            else                               TX_.keys[i] = 0;
-        } else {
-            if (TX_.keys[i] & TxKeyState_PRESSED)   TX_.keys[i] = TxKeyState_HELD;
-            else if (TX_.keys[i] & TxKeyState_HELD) TX_.keys[i] = TxKeyState_HELD;
-            else                                    TX_.keys[i] = TxKeyState_PRESSED;
+            double timeout = TX_.key_repeating[i] ? TX_KEY_REPEAT_INTERVAL : TX_KEY_REPEAT_DELAY;
+            if (now - TX_.key_last_seen[i] > timeout) {
+                TX_.keys[i] = TxKeyState_RELEASED;
+            }
         }
     }
 #endif
 }
 
+TxKeyState tx_get_key_state(TxKeyCode key) {
+    return TX_.keys[key];
+}
+
+TxModifiers tx_get_modifiers(void) {
+    return TX_.modifiers;
+}
+
+int tx_get_key_press_count(TxKeyCode key) {
+    return TX_.key_presses[key];
+}
+
+const char *tx_get_text_input(int *len) {
+    if (len) *len = TX_.text_len;
+    return TX_.text;
+}
+
 bool tx_is_key_pressed(TxKeyCode key) {
     return TX_.keys[key] & TxKeyState_PRESSED;
 }
@@ -325,114 +1094,359 @@ bool tx_pressed_keys(uint32_t *c) {
     return false;
 }
 
-void tx_render_to_terminal(void) {
-    tx_move_cursor_to_origin_();
-
-    char cbuf[5] = {0};
-    for (int y = 0; y < TX_.screen_height; y++) {
-        for (int x = 0; x < TX_.screen_width; x++) {
-            uint32_t c = TX_.screen[x + y * TX_.screen_width];
-            if (c == 0) {
-                printf(" ");
-                continue;
-            }
+void tx_set_mouse_mode(TxMouseMode mode) {
+    static const char *modes[] = {
+        [TxMouseMode_CLICKS] = "1000",
+        [TxMouseMode_DRAG]   = "1002",
+        [TxMouseMode_MOTION] = "1003",
+    };
 
-            if (!tx_to_utf8(c, cbuf)) {
-                tx_error("Failed to encode character to UTF-8: 0x%X", c);
-                tx_clear_screen();
-                return;
-            }
+    // Written through stdio, so the rest of the last frame has to go out first
+    tx_drain_pending_(true);
 
-            printf("%s", cbuf);
-        }
+    if (TX_.mouse_mode != TxMouseMode_OFF) {
+        printf("\x1b[?1006l\x1b[?%sl", modes[TX_.mouse_mode]);
+    }
 
-        printf("\r\n");
+    if (mode != TxMouseMode_OFF) {
+        printf("\x1b[?%sh\x1b[?1006h", modes[mode]);
     }
+
+    fflush(stdout);
+    TX_.mouse_mode    = mode;
+    TX_.mouse_buttons = 0;
 }
 
-void tx_clear_screen(void) {
-    memset(TX_.screen, 0, (TX_.screen_width * TX_.screen_height) * sizeof(*TX_.screen));
+bool tx_next_mouse_event(TxMouseEvent *ev) {
+    if (TX_.mouse_event_next >= TX_.mouse_event_count) {
+        return false;
+    }
+    *ev = TX_.mouse_events[TX_.mouse_event_next++];
+    return true;
 }
 
-void tx_draw_rec(TxRectangle rec) {
-    static const uint32_t palette[] = {
-        0x2500, // ─ - Horizontal
-        0x2502, // │ - Vertical
-        0x250C, // ┌ - Top Left
-        0x2510, // ┐ - Top Right
-        0x2514, // └ - Bottom Left
-        0x2518  // ┘ - Bottom Right
-    };
+TxVector tx_get_mouse_pos(void) {
+    return TX_.mouse_pos;
+}
 
-    TxVector min = tx_round_pos_(rec.pos);
-    TxVector max = tx_round_pos_(TxVector_add(rec.pos, (TxVector){.x=rec.size.x, .y=rec.size.y}));
+bool tx_is_mouse_button_held(TxMouseButton button) {
+    return TX_.mouse_buttons & (1 << button);
+}
 
-    // corners
-    tx_draw_char(palette[2], min);
-    tx_draw_char(palette[3], (TxVector){.x=max.x, .y=min.y, .z=min.z});
-    tx_draw_char(palette[4], (TxVector){.x=min.x, .y=max.y, .z=min.z});
-    tx_draw_char(palette[5], max);
+void tx_render_to_terminal(void) {
+    tx_accept_sinks_();
 
-    // left edge
-    for (float y = min.y + 1.f; y < max.y; y += 1.f) {
-        tx_draw_char(palette[1], (TxVector){.x=min.x, .y=y, .z=min.z});
+    // Rather than queue frames behind a slow terminal, skip them and leave the front buffer
+    // alone, so the next frame sent carries everything that changed
+    tx_drain_pending_(false);
+    if (tx_output_backlogged_()) {
+        TX_.stats.coalesced_frames++;
+        return;
     }
+    TX_.stats.frames++;
 
-    // top edge
-    for (float x = min.x + 1.f; x < max.x; x += 1.f) {
-        tx_draw_char(palette[0], (TxVector){.x=x, .y=min.y, .z=min.z});
+    if (TX_.keyframe) {
+        tx_encode_keyframe_();
+        TX_.keyframe = false;
+    } else {
+        tx_encode_delta_();
     }
+    tx_out_flush_();
 
-    // right edge
-    for (float y = min.y + 1.f; y < max.y; y += 1.f) {
-        tx_draw_char(palette[1], (TxVector){.x=max.x, .y=y, .z=min.z});
+    // Sinks that joined or fell behind get the whole screen, encoded once for all of them
+    bool resync = false;
+    for (int i = 0; i < TX_.sink_count; i++) {
+        resync |= !TX_.sinks[i].synced;
+        TX_.sinks[i].resync_ok = true;
     }
+    if (!resync) return;
 
-    // bottom edge
-    for (float x = min.x + 1.f; x < max.x; x += 1.f) {
-        tx_draw_char(palette[0], (TxVector){.x=x, .y=max.y, .z=min.z});
+    // A sink cut off mid-frame may be inside a sequence and still have its colours set, so
+    // cancel and reset both before clearing
+    TX_.out_to_sinks = true;
+    tx_out_append_("\x18\x1b[0m\x1b[?25l\x1b[2J", 15);
+    tx_encode_keyframe_();
+    tx_out_flush_();
+    TX_.out_to_sinks = false;
+
+    for (int i = 0; i < TX_.sink_count; i++) {
+        if (!TX_.sinks[i].synced) TX_.sinks[i].synced = TX_.sinks[i].resync_ok;
     }
 }
 
-void tx_fill_rec(TxRectangle rec) {
-    static const uint32_t palette[] = {
-        0x2584, // ▄ - Top Horizontal
-        0x2580, // ▀ - Bottom Horizontal
-        0x258C, // ▌ - Right Vertical
-        0x2590, // ▐ - Left Vertical
-        0x2588, // █ - Fill
-        0x2597, // ▗ - Top Left Corner
-        0x2596, // ▖ - Top Right Corner
-        0x259D, // ▝ - Bottom Left Corner
-        0x2598, // ▘ - Bottom Right Corner
-    };
+void tx_get_stats(TxStats *stats) {
+    *stats = TX_.stats;
+    stats->bytes_pending = TX_.pending_len;
+}
 
-    TxVector min = tx_round_pos_(rec.pos);
-    TxVector max = tx_round_pos_(TxVector_add(rec.pos, (TxVector){.x=rec.size.x, .y=rec.size.y}));
+void tx_run(TxUpdateProc *update, TxRenderProc *render, float hz) {
+    double dt = 1.0 / hz;
 
-    // corners
-    tx_draw_char(palette[5], min);
-    tx_draw_char(palette[6], (TxVector){.x=max.x, .y=min.y, .z=min.z});
-    tx_draw_char(palette[7], (TxVector){.x=min.x, .y=max.y, .z=min.z});
-    tx_draw_char(palette[8], max);
+    double now      = tx_time_now_();
+    double sim_time = now;      // Time the simulation has been advanced to
+    double deadline = now + dt; // When the next frame is due
+    double last     = now;
 
-    // left edge
-    for (float y = min.y + 1.f; y < max.y; y += 1.f) {
-        tx_draw_char(palette[3], (TxVector){.x=min.x, .y=y, .z=min.z});
-    }
+    // Frame interval statistics for the current one second window
+    double window_start = now, sum = 0.0, sum_sq = 0.0;
+    int    count = 0;
 
-    // top edge
-    for (float x = min.x + 1.f; x < max.x; x += 1.f) {
-        tx_draw_char(palette[0], (TxVector){.x=x, .y=min.y, .z=min.z});
-    }
+    for (;;) {
+        // Events are polled once per update, so each update sees every press exactly once
+        // however many updates a frame runs
+        int steps = 0;
+        for (; now - sim_time >= dt && steps < TX_MAX_CATCH_UP_STEPS; steps++) {
+            tx_poll_events();
+            if (!update((float)dt)) return;
+            sim_time += dt;
+        }
 
-    // right edge
-    for (float y = min.y + 1.f; y < max.y; y += 1.f) {
-        tx_draw_char(palette[2], (TxVector){.x=max.x, .y=y, .z=min.z});
-    }
+        // Too far behind to catch up, so let the simulation skip ahead
+        if (steps == TX_MAX_CATCH_UP_STEPS && now - sim_time >= dt) {
+            sim_time = now - fmod(now - sim_time, dt);
+        }
 
+        render((float)((now - sim_time) / dt));
+        tx_render_to_terminal();
 
-    // bottom edge
+        // Deadlines are absolute so sleep overshoot doesn't accumulate into drift
+        now = tx_time_now_();
+        if (now > deadline) {
+            TX_.stats.missed_deadlines++;
+            deadline += ceil((now - deadline) / dt) * dt;
+        }
+        tx_sleep_until_(deadline);
+        deadline += dt;
+
+        now = tx_time_now_();
+        double interval = now - last;
+        last = now;
+
+        sum    += interval;
+        sum_sq += interval * interval;
+        count++;
+
+        if (now - window_start >= 1.0) {
+            double mean = sum / count;
+            TX_.stats.fps          = count / (now - window_start);
+            TX_.stats.frame_jitter = sqrt(fmax(sum_sq / count - mean * mean, 0.0));
+
+            window_start = now;
+            sum = sum_sq = 0.0;
+            count = 0;
+        }
+    }
+}
+
+bool tx_add_sink(int fd) {
+    if (TX_.sink_count >= TX_MAX_SINKS) {
+        tx_error("Too many sinks, at most %d are supported", TX_MAX_SINKS);
+        return false;
+    }
+
+    // A slow sink must never block the frame
+    int flags = fcntl(fd, F_GETFL);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        tx_error("Failed to make sink non-blocking");
+        return false;
+    }
+
+    TX_.sinks[TX_.sink_count++] = (struct TxSink_){.fd = fd};
+    return true;
+}
+
+void tx_remove_sink(int fd) {
+    for (int i = 0; i < TX_.sink_count; i++) {
+        if (TX_.sinks[i].fd == fd) {
+            TX_.sinks[i] = TX_.sinks[--TX_.sink_count];
+            return;
+        }
+    }
+}
+
+bool tx_listen_for_sinks(const char *path) {
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    if (strlen(path) >= sizeof(addr.sun_path) || strlen(path) >= sizeof(TX_.sink_path)) {
+        tx_error("Socket path too long: %s", path);
+        return false;
+    }
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        tx_error("Failed to create sink socket");
+        return false;
+    }
+
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 8) < 0) {
+        tx_error("Failed to listen on %s", path);
+        close(fd);
+        return false;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    strcpy(TX_.sink_path, path);
+    TX_.sink_listener = fd;
+    return true;
+}
+
+void tx_clear_screen(void) {
+    memset(TX_.screen, 0, (TX_.screen_width * TX_.screen_height) * sizeof(*TX_.screen));
+
+    for (int i = 0; i < TX_.screen_width * TX_.screen_height; i++) {
+        TX_.fg[i] = TX_.draw_fg;
+        TX_.bg[i] = TX_.draw_bg;
+    }
+}
+
+void tx_set_fg(TxColor color) {
+    TX_.draw_fg = color;
+}
+
+void tx_set_bg(TxColor color) {
+    TX_.draw_bg = color;
+}
+
+void tx_set_color_depth(TxColorDepth depth) {
+    TX_.color_depth     = depth;
+    TX_.color_depth_set = true;
+    tx_build_color_lut_();
+    TX_.keyframe = true;
+}
+
+TxColorDepth tx_get_color_depth(void) {
+    return TX_.color_depth;
+}
+
+void tx_set_dither(bool enabled) {
+    if (TX_.dither != enabled) TX_.keyframe = true;
+    TX_.dither = enabled;
+}
+
+void tx_draw_image(const uint32_t *pixels, int w, int h, int stride, TxRectangle dst) {
+    int x0 = (int)roundf(dst.pos.x), y0 = (int)roundf(dst.pos.y);
+    int dw = (int)dst.size.x,        dh = (int)dst.size.y;
+    if (w <= 0 || h <= 0 || dw <= 0 || dh <= 0) return;
+
+    // Only the part on screen gets sampled
+    int cx0 = x0 < 0 ? 0 : x0, cx1 = x0 + dw < TX_.screen_width  ? x0 + dw : TX_.screen_width;
+    int cy0 = y0 < 0 ? 0 : y0, cy1 = y0 + dh < TX_.screen_height ? y0 + dh : TX_.screen_height;
+    if (cx0 >= cx1 || cy0 >= cy1) return;
+
+    int  n      = cx1 - cx0;
+    bool scaled = dw != w || dh * 2 != h;
+
+    // Nearest neighbour, sampling the middle of each destination pixel
+    if (scaled) {
+        for (int x = cx0; x < cx1; x++) {
+            TX_.image_xmap[x - cx0] = (int)(((int64_t)(x - x0) * 2 + 1) * w / (2 * dw));
+        }
+    }
+
+    for (int y = cy0; y < cy1; y++) {
+        int64_t py = (int64_t)(y - y0) * 2;
+        int64_t ty = scaled ? (py * 2 + 1) * h / (4 * dh) : py;
+        int64_t by = scaled ? (py * 2 + 3) * h / (4 * dh) : py + 1;
+
+        const uint32_t *top    = pixels + ty * stride;
+        const uint32_t *bottom = pixels + by * stride;
+
+        // The edges may cut through wide characters, which have to be cleared properly
+        int row = y * TX_.screen_width;
+        tx_put_cell_(row + cx0, tx_fill_palette_[1]);
+        tx_put_cell_(row + cx1 - 1, tx_fill_palette_[1]);
+        for (int i = row + cx0; i < row + cx1; i++) {
+            TX_.screen[i] = tx_fill_palette_[1];
+        }
+
+        TxColor *fg = TX_.fg + row + cx0;
+        TxColor *bg = TX_.bg + row + cx0;
+
+        if (scaled) {
+            tx_pack_half_blocks_mapped_(fg, bg, top, bottom, TX_.image_xmap, n);
+        } else {
+            tx_pack_half_blocks_(fg, bg, top + (cx0 - x0), bottom + (cx0 - x0), n);
+        }
+
+        // Compared against what the terminal shows, as the back buffer is usually just cleared
+        if (TX_.image_tolerance > 0) {
+            const TxColor *front_fg = TX_.front_fg + row + cx0;
+            const TxColor *front_bg = TX_.front_bg + row + cx0;
+            for (int i = 0; i < n; i++) {
+                fg[i] = tx_keep_close_color_(front_fg[i], fg[i], TX_.image_tolerance);
+                bg[i] = tx_keep_close_color_(front_bg[i], bg[i], TX_.image_tolerance);
+            }
+        }
+    }
+}
+
+void tx_set_image_tolerance(int tolerance) {
+    TX_.image_tolerance = tolerance;
+}
+
+void tx_draw_rec(TxRectangle rec) {
+    const uint32_t *palette = tx_rec_palette_;
+
+    TxVector min = tx_round_pos_(rec.pos);
+    TxVector max = tx_round_pos_(TxVector_add(rec.pos, (TxVector){.x=rec.size.x, .y=rec.size.y}));
+
+    // corners
+    tx_draw_char(palette[2], min);
+    tx_draw_char(palette[3], (TxVector){.x=max.x, .y=min.y, .z=min.z});
+    tx_draw_char(palette[4], (TxVector){.x=min.x, .y=max.y, .z=min.z});
+    tx_draw_char(palette[5], max);
+
+    // left edge
+    for (float y = min.y + 1.f; y < max.y; y += 1.f) {
+        tx_draw_char(palette[1], (TxVector){.x=min.x, .y=y, .z=min.z});
+    }
+
+    // top edge
+    for (float x = min.x + 1.f; x < max.x; x += 1.f) {
+        tx_draw_char(palette[0], (TxVector){.x=x, .y=min.y, .z=min.z});
+    }
+
+    // right edge
+    for (float y = min.y + 1.f; y < max.y; y += 1.f) {
+        tx_draw_char(palette[1], (TxVector){.x=max.x, .y=y, .z=min.z});
+    }
+
+    // bottom edge
+    for (float x = min.x + 1.f; x < max.x; x += 1.f) {
+        tx_draw_char(palette[0], (TxVector){.x=x, .y=max.y, .z=min.z});
+    }
+}
+
+void tx_fill_rec(TxRectangle rec) {
+    const uint32_t *palette = tx_fill_palette_;
+
+    TxVector min = tx_round_pos_(rec.pos);
+    TxVector max = tx_round_pos_(TxVector_add(rec.pos, (TxVector){.x=rec.size.x, .y=rec.size.y}));
+
+    // corners
+    tx_draw_char(palette[5], min);
+    tx_draw_char(palette[6], (TxVector){.x=max.x, .y=min.y, .z=min.z});
+    tx_draw_char(palette[7], (TxVector){.x=min.x, .y=max.y, .z=min.z});
+    tx_draw_char(palette[8], max);
+
+    // left edge
+    for (float y = min.y + 1.f; y < max.y; y += 1.f) {
+        tx_draw_char(palette[3], (TxVector){.x=min.x, .y=y, .z=min.z});
+    }
+
+    // top edge
+    for (float x = min.x + 1.f; x < max.x; x += 1.f) {
+        tx_draw_char(palette[0], (TxVector){.x=x, .y=min.y, .z=min.z});
+    }
+
+    // right edge
+    for (float y = min.y + 1.f; y < max.y; y += 1.f) {
+        tx_draw_char(palette[2], (TxVector){.x=max.x, .y=y, .z=min.z});
+    }
+
+
+    // bottom edge
     for (float x = min.x + 1.f; x < max.x; x += 1.f) {
         tx_draw_char(palette[1], (TxVector){.x=x, .y=max.y, .z=min.z});
     }
@@ -451,195 +1465,2233 @@ void tx_draw_char(uint32_t c, TxVector p) {
     tx_set_cell_(idx, c, p.z);
 }
 
-void tx_draw_text(const char *text, TxVector pos) {
-    int text_len = strlen(text);
-    int idx = tx_pos_to_idx_(pos);
-    for (int i = 0; i < text_len; i++) {
-        if (idx >= TX_.screen_width * TX_.screen_height) {
+void tx_draw_text(const char *text, TxVector pos) {
+    int text_len = strlen(text);
+    int idx = tx_pos_to_idx_(pos);
+    for (int i = 0; i < text_len;) {
+        if (idx >= TX_.screen_width * TX_.screen_height) {
+            break;
+        }
+
+        uint32_t c;
+        i += tx_utf8_decode_(text + i, text_len - i, &c);
+
+        // Combining marks don't get a cell of their own
+        if (tx_char_width(c) == 0) continue;
+
+        idx += tx_set_cell_(idx, c, pos.z);
+    }
+}
+
+void tx_draw_list_free(TxDrawList *dl) {
+    tx_free_(dl->order);
+    tx_free_(dl->data);
+    tx_free_(dl->cmds);
+    *dl = (TxDrawList){0};
+}
+
+void tx_draw_list_clear(TxDrawList *dl) {
+    dl->count    = 0;
+    dl->data_len = 0;
+    dl->sorted   = false;
+}
+
+void tx_draw_list_set_fg(TxDrawList *dl, TxColor color) {
+    dl->fg = color;
+}
+
+void tx_draw_list_set_bg(TxDrawList *dl, TxColor color) {
+    dl->bg = color;
+}
+
+void tx_draw_list_rec(TxDrawList *dl, TxRectangle rec) {
+    TxDrawCommand *cmd = tx_draw_list_push_(dl, TxDrawCommandKind_REC, rec.pos);
+    if (cmd) cmd->size = rec.size;
+}
+
+void tx_draw_list_fill_rec(TxDrawList *dl, TxRectangle rec) {
+    TxDrawCommand *cmd = tx_draw_list_push_(dl, TxDrawCommandKind_FILL_REC, rec.pos);
+    if (cmd) cmd->size = rec.size;
+}
+
+void tx_draw_list_char(TxDrawList *dl, uint32_t c, TxVector p) {
+    TxDrawCommand *cmd = tx_draw_list_push_(dl, TxDrawCommandKind_CHAR, p);
+    if (cmd) cmd->c = c;
+}
+
+void tx_draw_list_text(TxDrawList *dl, const char *text, TxVector pos) {
+    uint32_t len = (uint32_t)strlen(text);
+    if (!tx_draw_list_reserve_data_(dl, len)) return;
+
+    TxDrawCommand *cmd = tx_draw_list_push_(dl, TxDrawCommandKind_TEXT, pos);
+    if (!cmd) return;
+
+    cmd->data = dl->data_len;
+    cmd->len  = len;
+    memcpy(dl->data + dl->data_len, text, len);
+    dl->data_len += len;
+}
+
+void tx_draw_list_sprite(TxDrawList *dl, const uint32_t *cells, int w, int h, TxVector pos) {
+    if (w <= 0 || h <= 0) return;
+
+    // Keep cells 4-byte aligned within the data block
+    uint32_t offset = (dl->data_len + 3u) & ~3u;
+    uint32_t len    = (uint32_t)(w * h) * sizeof(*cells);
+    if (!tx_draw_list_reserve_data_(dl, offset - dl->data_len + len)) return;
+
+    TxDrawCommand *cmd = tx_draw_list_push_(dl, TxDrawCommandKind_SPRITE, pos);
+    if (!cmd) return;
+
+    cmd->size = (TxVector){.x = (float)w, .y = (float)h};
+    cmd->data = offset;
+    cmd->len  = len;
+    memcpy(dl->data + offset, cells, len);
+    dl->data_len = offset + len;
+}
+
+void tx_draw_list_append(TxDrawList *dst, const TxDrawList *src) {
+    uint32_t base = (dst->data_len + 3u) & ~3u;
+    if (!tx_draw_list_reserve_data_(dst, base - dst->data_len + src->data_len)) return;
+    memcpy(dst->data + base, src->data, src->data_len);
+
+    for (uint32_t i = 0; i < src->count; i++) {
+        TxDrawCommand *cmd = tx_draw_list_push_(dst, src->cmds[i].kind, src->cmds[i].pos);
+        if (!cmd) return;
+        *cmd = src->cmds[i];
+        cmd->data += base;
+    }
+
+    dst->data_len = base + src->data_len;
+}
+
+void tx_submit_draw_list(TxDrawList *dl) {
+    if (dl->count == 0) return;
+
+    if (!dl->sorted) {
+        if (dl->order_cap < dl->count) {
+            void *order = tx_realloc_(dl->order, dl->count * sizeof(*dl->order));
+            if (!order) {
+                tx_error("Failed to allocate draw list order");
+                return;
+            }
+            dl->order     = order;
+            dl->order_cap = dl->count;
+        }
+
+        bool in_order = true;
+        for (uint32_t i = 0; i < dl->count; i++) {
+            dl->order[i] = (struct TxDrawSortKey){.z = dl->cmds[i].pos.z, .index = i};
+            if (i > 0 && dl->order[i].z < dl->order[i - 1].z) in_order = false;
+        }
+
+        // Lists are commonly recorded back to front already
+        if (!in_order) {
+            qsort(dl->order, dl->count, sizeof(*dl->order), tx_compare_sort_keys_);
+        }
+        dl->sorted = true;
+    }
+
+    TxColor fg = TX_.draw_fg, bg = TX_.draw_bg;
+
+    for (uint32_t i = 0; i < dl->count; i++) {
+        const TxDrawCommand *cmd = &dl->cmds[dl->order[i].index];
+        int x = (int)roundf(cmd->pos.x);
+        int y = (int)roundf(cmd->pos.y);
+
+        TX_.draw_fg = cmd->fg;
+        TX_.draw_bg = cmd->bg;
+
+        switch (cmd->kind) {
+            case TxDrawCommandKind_REC:
+                tx_raster_rec_((TxRectangle){cmd->pos, cmd->size}, tx_rec_palette_, false);
+                break;
+            case TxDrawCommandKind_FILL_REC:
+                tx_raster_rec_((TxRectangle){cmd->pos, cmd->size}, tx_fill_palette_, true);
+                break;
+            case TxDrawCommandKind_CHAR:
+                tx_plot_(cmd->c, x, y);
+                break;
+            case TxDrawCommandKind_TEXT: {
+                const char *text = dl->data + cmd->data;
+                for (uint32_t j = 0; j < cmd->len;) {
+                    uint32_t c;
+                    j += (uint32_t)tx_utf8_decode_(text + j, (int)(cmd->len - j), &c);
+
+                    int w = tx_char_width(c);
+                    if (w == 0) continue;
+
+                    tx_plot_(c, x, y);
+                    x += w;
+                }
+            } break;
+            case TxDrawCommandKind_SPRITE: {
+                const uint32_t *cells = (const uint32_t *)(dl->data + cmd->data);
+                int w = (int)cmd->size.x, h = (int)cmd->size.y;
+                for (int sy = 0; sy < h; sy++) {
+                    for (int sx = 0; sx < w; sx++) {
+                        uint32_t c = cells[sx + sy * w];
+                        if (c != 0) tx_plot_(c, x + sx, y + sy);
+                    }
+                }
+            } break;
+        }
+    }
+
+    TX_.draw_fg = fg;
+    TX_.draw_bg = bg;
+}
+
+void tx_text_input_free(TxTextInput *ti) {
+    tx_free_(ti->buf);
+    *ti = (TxTextInput){0};
+}
+
+void tx_text_input_clear(TxTextInput *ti) {
+    ti->gap_start   = 0;
+    ti->gap_end     = ti->cap;
+    ti->cursor_col  = 0;
+    ti->scroll_col  = 0;
+    ti->scroll_byte = 0;
+    ti->dirty_col   = 0;
+}
+
+void tx_text_input_insert(TxTextInput *ti, const char *text, uint32_t len) {
+    if (len == 0 || !tx_text_input_reserve_(ti, len)) return;
+
+    if (ti->cursor_col < ti->dirty_col) ti->dirty_col = ti->cursor_col;
+
+    memcpy(ti->buf + ti->gap_start, text, len);
+    ti->gap_start += len;
+
+    for (uint32_t i = 0; i < len;) {
+        uint32_t c;
+        i += (uint32_t)tx_utf8_decode_(text + i, (int)(len - i), &c);
+        ti->cursor_col += (uint32_t)tx_char_width(c);
+    }
+}
+
+void tx_text_input_delete_back(TxTextInput *ti) {
+    if (ti->gap_start == 0) return;
+
+    uint32_t end = ti->gap_start;
+    ti->gap_start = tx_text_input_prev_(ti, end);
+
+    uint32_t c;
+    tx_utf8_decode_(ti->buf + ti->gap_start, (int)(end - ti->gap_start), &c);
+    ti->cursor_col -= (uint32_t)tx_char_width(c);
+    if (ti->cursor_col < ti->dirty_col) ti->dirty_col = ti->cursor_col;
+}
+
+void tx_text_input_delete_forward(TxTextInput *ti) {
+    if (ti->gap_end == ti->cap) return;
+
+    do {
+        ti->gap_end++;
+    } while (ti->gap_end < ti->cap && ((uint8_t)ti->buf[ti->gap_end] & 0xC0) == 0x80);
+
+    if (ti->cursor_col < ti->dirty_col) ti->dirty_col = ti->cursor_col;
+}
+
+void tx_text_input_move(TxTextInput *ti, int chars) {
+    uint32_t i = ti->gap_start;
+
+    // Combining marks move together with the character they follow
+    for (; chars < 0 && i > 0; chars++) {
+        int w;
+        do {
+            uint32_t c;
+            i = tx_text_input_prev_(ti, i);
+            tx_text_input_next_(ti, i, &c);
+            w = tx_char_width(c);
+            ti->cursor_col -= (uint32_t)w;
+        } while (w == 0 && i > 0);
+    }
+
+    uint32_t len = tx_text_input_length(ti);
+    for (; chars > 0 && i < len; chars--) {
+        uint32_t c;
+        i = tx_text_input_next_(ti, i, &c);
+        ti->cursor_col += (uint32_t)tx_char_width(c);
+
+        while (i < len) {
+            uint32_t next = tx_text_input_next_(ti, i, &c);
+            if (tx_char_width(c) != 0) break;
+            i = next;
+        }
+    }
+
+    tx_text_input_move_gap_(ti, i);
+}
+
+void tx_text_input_update(TxTextInput *ti) {
+    int len = 0;
+    const char *text = tx_get_text_input(&len);
+
+#ifdef __APPLE__
+    tx_text_input_insert(ti, text, (uint32_t)len);
+
+    static const TxKeyCode edit_keys[] = {
+        TxKeyCode_BACKSPACE, TxKeyCode_DELETE, TxKeyCode_ARROW_LEFT, TxKeyCode_ARROW_RIGHT, TxKeyCode_HOME, TxKeyCode_END,
+    };
+    for (size_t i = 0; i < sizeof(edit_keys) / sizeof(*edit_keys); i++) {
+        for (int n = tx_get_key_press_count(edit_keys[i]); n > 0; n--) tx_text_input_apply_key_(ti, edit_keys[i]);
+    }
+#else
+    // Replay the frame's keys between the pieces of text typed around them
+    int done = 0;
+    for (int i = 0; i < TX_.key_log_count; i++) {
+        int at = TX_.key_log[i].text_len;
+        tx_text_input_insert(ti, text + done, (uint32_t)(at - done));
+        done = at;
+
+        tx_text_input_apply_key_(ti, TX_.key_log[i].key);
+    }
+    tx_text_input_insert(ti, text + done, (uint32_t)(len - done));
+#endif
+}
+
+void tx_text_input_draw(TxTextInput *ti, TxVector pos, int width) {
+    if (width <= 0) return;
+
+    // Scroll just far enough to keep the cursor in view
+    uint32_t scroll = ti->scroll_col;
+    if (ti->cursor_col < ti->scroll_col) {
+        ti->scroll_col  = ti->cursor_col;
+        ti->scroll_byte = ti->gap_start;
+    } else if (ti->cursor_col >= ti->scroll_col + (uint32_t)width) {
+        // Walk back from the cursor until the characters before it fill the width
+        uint32_t col = ti->cursor_col, i = ti->gap_start;
+        while (i > 0) {
+            uint32_t c, prev = tx_text_input_prev_(ti, i);
+            tx_text_input_next_(ti, prev, &c);
+
+            uint32_t w = (uint32_t)tx_char_width(c);
+            if (ti->cursor_col - (col - w) >= (uint32_t)width) break;
+
+            col -= w;
+            i    = prev;
+        }
+        ti->scroll_col  = col;
+        ti->scroll_byte = i;
+    }
+
+    bool moved = ti->drawn_width != width || ti->drawn_pos.x != pos.x || ti->drawn_pos.y != pos.y;
+    uint32_t from = ti->scroll_col;
+    if (scroll == ti->scroll_col && !moved && ti->dirty_col > from) {
+        from = ti->dirty_col;
+    }
+
+    ti->dirty_col   = UINT32_MAX;
+    ti->drawn_pos   = pos;
+    ti->drawn_width = width;
+
+    uint32_t end = ti->scroll_col + (uint32_t)width;
+    if (from >= end) return;
+
+    uint32_t len = tx_text_input_length(ti);
+    uint32_t i   = ti->scroll_byte;
+    uint32_t col = ti->scroll_col;
+
+    // Start at the character covering `from`, a wide one begins a column earlier
+    while (i < len) {
+        uint32_t c, next = tx_text_input_next_(ti, i, &c);
+        uint32_t w = (uint32_t)tx_char_width(c);
+        if (col + w > from) break;
+        col += w;
+        i    = next;
+    }
+
+    int x = (int)roundf(pos.x) - (int)ti->scroll_col;
+    int y = (int)roundf(pos.y);
+    while (col < end) {
+        uint32_t c = 0, w = 1;
+        if (i < len) {
+            i = tx_text_input_next_(ti, i, &c);
+            w = (uint32_t)tx_char_width(c);
+            if (w == 0) continue;
+
+            // A wide character cut off by the edge leaves a blank
+            if (col + w > end) c = 0, w = 1;
+        }
+        tx_plot_(c, x + (int)col, y);
+        col += w;
+    }
+}
+
+void tx_text_input_invalidate(TxTextInput *ti) {
+    ti->dirty_col = 0;
+    ti->drawn_width = 0;
+}
+
+uint32_t tx_text_input_length(const TxTextInput *ti) {
+    return ti->cap - (ti->gap_end - ti->gap_start);
+}
+
+uint32_t tx_text_input_get(const TxTextInput *ti, char *dst, uint32_t cap) {
+    if (cap == 0) return 0;
+
+    uint32_t before = ti->gap_start;
+    uint32_t after  = ti->cap - ti->gap_end;
+    if (before > cap - 1)         before = cap - 1;
+    if (after > cap - 1 - before) after  = cap - 1 - before;
+
+    memcpy(dst, ti->buf, before);
+    memcpy(dst + before, ti->buf + ti->gap_end, after);
+    dst[before + after] = 0;
+    return before + after;
+}
+
+bool tx_scroll_view_open(TxScrollView *sv, const char *path) {
+    *sv = (TxScrollView){.top_line_known = true};
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        tx_error("Failed to open %s", path);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        tx_error("Failed to stat %s", path);
+        close(fd);
+        return false;
+    }
+
+    struct TxScrollIndex_ *idx = tx_alloc_(sizeof(*idx));
+    if (!idx) {
+        tx_error("Failed to allocate line index");
+        close(fd);
+        return false;
+    }
+    memset(idx, 0, sizeof(*idx));
+
+    idx->fd   = fd;
+    idx->size = (size_t)st.st_size;
+    if (idx->size > 0) {
+        void *data = mmap(NULL, idx->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            tx_error("Failed to map %s", path);
+            close(fd);
+            tx_free_(idx);
+            return false;
+        }
+        idx->data = data;
+    }
+
+    idx->stride = TX_SCROLL_INDEX_STRIDE;
+    while (idx->size / idx->stride >= TX_SCROLL_INDEX_MAX_ENTRIES) {
+        idx->stride *= 2;
+    }
+
+    sv->data  = idx->data;
+    sv->size  = idx->size;
+    sv->index = idx;
+
+    if (pthread_create(&idx->thread, NULL, tx_scroll_index_run_, idx) != 0) {
+        tx_error("Failed to start line indexer");
+        tx_scroll_view_close(sv);
+        return false;
+    }
+    idx->started = true;
+
+    return true;
+}
+
+void tx_scroll_view_close(TxScrollView *sv) {
+    struct TxScrollIndex_ *idx = sv->index;
+    if (!idx) return;
+
+    if (idx->started) {
+        atomic_store(&idx->stop, true);
+        pthread_join(idx->thread, NULL);
+    }
+
+    for (size_t i = sizeof(idx->chunks) / sizeof(*idx->chunks); i-- > 0;) {
+        tx_free_(idx->chunks[i]);
+    }
+
+    if (idx->data) munmap((void *)idx->data, idx->size);
+    close(idx->fd);
+    tx_free_(idx);
+    *sv = (TxScrollView){0};
+}
+
+uint64_t tx_scroll_view_line_count(const TxScrollView *sv, bool *complete) {
+    if (complete) *complete = atomic_load(&sv->index->done);
+    return atomic_load(&sv->index->lines);
+}
+
+void tx_scroll_view_scroll(TxScrollView *sv, int64_t lines) {
+    for (; lines > 0; lines--) {
+        size_t next = tx_scroll_next_line_(sv, sv->top);
+        if (next >= sv->size) break;
+        sv->top = next;
+        sv->top_line++;
+    }
+
+    for (; lines < 0 && sv->top > 0; lines++) {
+        sv->top = tx_scroll_prev_line_(sv, sv->top);
+        sv->top_line--;
+    }
+}
+
+bool tx_scroll_view_goto_line(TxScrollView *sv, uint64_t line) {
+    struct TxScrollIndex_ *idx = sv->index;
+
+    bool     done    = atomic_load_explicit(&idx->done, memory_order_acquire);
+    uint64_t entries = atomic_load_explicit(&idx->entries, memory_order_acquire);
+    uint64_t lines   = atomic_load_explicit(&idx->lines, memory_order_acquire);
+
+    if (done && lines > 0 && line >= lines) {
+        line = lines - 1;
+    }
+
+    uint64_t k = line / idx->stride;
+    if (k >= entries) {
+        return false;
+    }
+
+    sv->top            = (size_t)idx->chunks[k / TX_SCROLL_INDEX_CHUNK_][k % TX_SCROLL_INDEX_CHUNK_];
+    sv->top_line       = k * idx->stride;
+    sv->top_line_known = true;
+    tx_scroll_view_scroll(sv, (int64_t)(line - sv->top_line));
+    return true;
+}
+
+void tx_scroll_view_goto_end(TxScrollView *sv, int height) {
+    sv->top = sv->size;
+    int steps = 0;
+    for (; steps < height && sv->top > 0; steps++) {
+        sv->top = tx_scroll_prev_line_(sv, sv->top);
+    }
+
+    bool complete = false;
+    uint64_t lines = tx_scroll_view_line_count(sv, &complete);
+    sv->top_line_known = complete;
+    sv->top_line       = complete ? lines - (uint64_t)steps : 0;
+}
+
+void tx_scroll_view_draw(TxScrollView *sv, TxRectangle rec) {
+    int x0 = (int)roundf(rec.pos.x), y0 = (int)roundf(rec.pos.y);
+    int w  = (int)rec.size.x,        h  = (int)rec.size.y;
+
+    size_t o = sv->top;
+    for (int row = 0; row < h; row++) {
+        size_t end = o < sv->size ? tx_scroll_next_line_(sv, o) : o;
+        size_t i   = o;
+
+        uint32_t col = 0;
+        while (col < sv->left_col && i < end) {
+            uint32_t c;
+            i += tx_utf8_decode_(sv->data + i, end - i < 4 ? (int)(end - i) : 4, &c);
+            col += c < 0x20 || c == 0x7F ? 1 : (uint32_t)tx_char_width(c);
+        }
+
+        // A wide character cut in half by the left edge leaves a blank
+        int x = 0;
+        if (col > sv->left_col && w > 0) {
+            tx_plot_(0, x0 + x++, y0 + row);
+        }
+
+        while (x < w && i < end) {
+            uint32_t c;
+            i += tx_utf8_decode_(sv->data + i, end - i < 4 ? (int)(end - i) : 4, &c);
+            if (c == '\n' || c == '\r') break;
+            if (c < 0x20 || c == 0x7F) c = ' ';
+
+            int cw = tx_char_width(c);
+            if (cw == 0) continue;
+            if (x + cw > w) break;
+
+            tx_plot_(c, x0 + x, y0 + row);
+            x += cw;
+        }
+
+        for (; x < w; x++) {
+            tx_plot_(0, x0 + x, y0 + row);
+        }
+
+        o = end;
+    }
+}
+
+bool tx_start_recording(const char *path) {
+    if (TX_.recorder) {
+        tx_error("Already recording");
+        return false;
+    }
+
+    struct TxRecorder_ *rec = tx_alloc_(sizeof(*rec));
+    char *ring = tx_alloc_(TX_RECORD_BUFFER_SIZE);
+    if (!rec || !ring) {
+        tx_error("Failed to allocate recorder");
+        tx_free_(ring);
+        tx_free_(rec);
+        return false;
+    }
+    *rec = (struct TxRecorder_){.ring = ring, .cap = TX_RECORD_BUFFER_SIZE, .start = tx_time_now_()};
+
+    rec->file = fopen(path, "w");
+    if (!rec->file) {
+        tx_error("Failed to open %s for recording", path);
+        tx_free_(ring);
+        tx_free_(rec);
+        return false;
+    }
+
+    // The screen is one column and row smaller than the terminal
+    fprintf(rec->file, "{\"version\": 2, \"width\": %d, \"height\": %d, \"timestamp\": %lld}\n",
+            TX_.screen_width + 1, TX_.screen_height + 1, (long long)time(NULL));
+
+    pthread_mutex_init(&rec->lock, NULL);
+    pthread_cond_init(&rec->wake, NULL);
+    if (pthread_create(&rec->thread, NULL, tx_recorder_run_, rec) != 0) {
+        tx_error("Failed to start recorder thread");
+        fclose(rec->file);
+        tx_free_(ring);
+        tx_free_(rec);
+        return false;
+    }
+
+    TX_.recorder = rec;
+    TX_.keyframe = true; // The recording has to start from a full frame
+    return true;
+}
+
+void tx_stop_recording(void) {
+    struct TxRecorder_ *rec = TX_.recorder;
+    if (!rec) return;
+    TX_.recorder = NULL;
+
+    pthread_mutex_lock(&rec->lock);
+    rec->stop = true;
+    pthread_cond_signal(&rec->wake);
+    pthread_mutex_unlock(&rec->lock);
+    pthread_join(rec->thread, NULL);
+
+    if (rec->dropped > 0) {
+        tx_info("Recording dropped %llu events that didn't fit in the buffer", (unsigned long long)rec->dropped);
+    }
+
+    fclose(rec->file);
+    pthread_cond_destroy(&rec->wake);
+    pthread_mutex_destroy(&rec->lock);
+    tx_free_(rec->ring);
+    tx_free_(rec);
+}
+
+bool tx_replay_recording(const char *path, float speed, TxReplayStats *stats) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        tx_error("Failed to open recording %s", path);
+        return false;
+    }
+
+    // Written straight to the terminal, after anything still queued
+    tx_drain_pending_(true);
+    fflush(stdout);
+
+    TxReplayStats totals = {0};
+    double start = tx_time_now_();
+
+    char * line = NULL, *data = NULL;
+    size_t line_cap = 0, data_cap = 0;
+    for (ssize_t n; (n = getline(&line, &line_cap, f)) > 0;) {
+        // Events look like `[time, "o", "data"]`; the header and other kinds are skipped
+        double t = 0;
+        int    offset = 0;
+        if (sscanf(line, " [ %lf , \"o\" , %n", &t, &offset) != 1 || offset == 0 || line[offset] != '"') {
+            continue;
+        }
+
+        if (data_cap < (size_t)n) {
+            char *grown = tx_realloc_(data, (size_t)n);
+            if (!grown) {
+                tx_error("Failed to allocate replay buffer");
+                break;
+            }
+            data     = grown;
+            data_cap = (size_t)n;
+        }
+        size_t len = tx_parse_json_string_(line + offset + 1, data);
+
+        if (speed > 0) {
+            double wait = start + t / speed - tx_time_now_();
+            if (wait > 0) {
+                struct timespec ts = {.tv_sec = (time_t)wait, .tv_nsec = (long)((wait - (time_t)wait) * 1e9)};
+                nanosleep(&ts, NULL);
+            }
+        }
+
+        tx_write_all_(STDOUT_FILENO, data, len);
+        totals.frames++;
+        totals.bytes += len;
+    }
+
+    totals.seconds = tx_time_now_() - start;
+    if (stats) *stats = totals;
+
+    free(line); // Allocated by getline
+    tx_free_(data);
+    fclose(f);
+    return true;
+}
+
+void tx_set_log_level(TxLogLevel lv) {
+    TX_.log_level = lv;
+}
+
+void tx_log(TxLogLevel lv, const char *restrict fmt, ...) {
+    static const char *level_labels[TxLogLevel_COUNT] = {
+        [TxLogLevel_ALL]   = "LOG",
+        [TxLogLevel_DEBUG] = "DEBUG",
+        [TxLogLevel_INFO]  = "INFO",
+        [TxLogLevel_ERROR] = "ERROR",
+    };
+
+    if (lv >= TxLogLevel_NONE) return;
+
+    va_list args;
+    va_start(args, fmt);
+    {
+        fprintf(stderr, "%s: ", level_labels[lv]);
+        vfprintf(stderr, fmt, args);
+        fprintf(stderr, "\n");
+    }
+    va_end(args);
+}
+
+bool tx_to_utf8(uint32_t c, char buf[static 5]) {
+    memset(buf, 0, 5);
+
+    int clen = tx_codepoint_length_(c);
+    if (clen == 0) {
+        return false;
+    }
+
+    switch (clen) {
+        case 1:
+            buf[0] = c & 0x7F;
+            break;
+        case 2:
+            buf[0] = 0xC0 | ((c >> 6) & 0x1F);
+            buf[1] = 0x80 | (c & 0x3F);
+            break;
+        case 3:
+            buf[0] = 0xE0 | ((c >> 12) & 0x0F);
+            buf[1] = 0x80 | ((c >> 6) & 0x3F);
+            buf[2] = 0x80 | (c & 0x3F);
+            break;
+        case 4:
+            buf[0] = 0xF0 | ((c >> 18) & 0x07);
+            buf[1] = 0x80 | ((c >> 12) & 0x3F);
+            buf[2] = 0x80 | ((c >> 6) & 0x3F);
+            buf[3] = 0x80 | (c & 0x3F);
+            break;
+    }
+
+    return true;
+}
+
+TxVector TxVector_add(TxVector a, TxVector b) {
+    return (TxVector) {
+        .x = a.x + b.x,
+        .y = a.y + b.y,
+    };
+}
+
+TxVector TxVector_mul(TxVector a, TxVector b) {
+    return (TxVector) {
+        .x = a.x * b.x,
+        .y = a.y * b.y,
+    };
+}
+
+static pthread_mutex_t tx_arena_lock_ = PTHREAD_MUTEX_INITIALIZER;
+
+static void *tx_alloc_(size_t size) {
+    if (!TX_.arena) return TX_MALLOC(size);
+
+    pthread_mutex_lock(&tx_arena_lock_);
+
+    size_t at  = (TX_.arena_used + (TX_ARENA_HEADER_ - 1)) & ~(size_t)(TX_ARENA_HEADER_ - 1);
+    void * ptr = NULL;
+    if (at + TX_ARENA_HEADER_ + size <= TX_.arena_size) {
+        struct TxArenaHeader_ header = {size, TX_.arena_last};
+        memcpy(TX_.arena + at, &header, sizeof(header));
+        ptr            = TX_.arena + at + TX_ARENA_HEADER_;
+        TX_.arena_last = at;
+        TX_.arena_used = at + TX_ARENA_HEADER_ + size;
+    }
+
+    pthread_mutex_unlock(&tx_arena_lock_);
+
+    if (!ptr) tx_error("Arena exhausted allocating %zu bytes", size);
+    return ptr;
+}
+
+static void *tx_realloc_(void *ptr, size_t size) {
+    if (!TX_.arena) return TX_REALLOC(ptr, size);
+    if (!ptr)       return tx_alloc_(size);
+
+    size_t at = (size_t)((char *)ptr - TX_.arena) - TX_ARENA_HEADER_;
+    struct TxArenaHeader_ header;
+    memcpy(&header, TX_.arena + at, sizeof(header));
+    size_t old = header.size;
+
+    // The latest block can grow in place
+    pthread_mutex_lock(&tx_arena_lock_);
+    bool in_place = at == TX_.arena_last && at + TX_ARENA_HEADER_ + size <= TX_.arena_size;
+    if (in_place) {
+        header.size = size;
+        memcpy(TX_.arena + at, &header, sizeof(header));
+        TX_.arena_used = at + TX_ARENA_HEADER_ + size;
+    }
+    pthread_mutex_unlock(&tx_arena_lock_);
+
+    if (in_place) return ptr;
+
+    void *grown = tx_alloc_(size);
+    if (grown) {
+        memcpy(grown, ptr, old < size ? old : size);
+        tx_free_(ptr);
+    }
+    return grown;
+}
+
+static void tx_free_(void *ptr) {
+    if (!TX_.arena) {
+        TX_FREE(ptr);
+        return;
+    }
+    if (!ptr) return;
+
+    pthread_mutex_lock(&tx_arena_lock_);
+
+    // Mark the block freed, then give back every freed block at the end of the arena
+    struct TxArenaHeader_ header;
+    size_t at = (size_t)((char *)ptr - TX_.arena) - TX_ARENA_HEADER_;
+    memcpy(&header, TX_.arena + at, sizeof(header));
+    header.size = TX_ARENA_FREED_;
+    memcpy(TX_.arena + at, &header, sizeof(header));
+
+    while (TX_.arena_last != TX_ARENA_NONE_) {
+        memcpy(&header, TX_.arena + TX_.arena_last, sizeof(header));
+        if (header.size != TX_ARENA_FREED_) break;
+        TX_.arena_last = header.prev;
+    }
+    TX_.arena_used = TX_.arena_last == TX_ARENA_NONE_ ? 0 : TX_.arena_last + TX_ARENA_HEADER_ + header.size;
+
+    pthread_mutex_unlock(&tx_arena_lock_);
+}
+
+static bool tx_enable_raw_mode_(void) {
+    if (tcgetattr(STDIN_FILENO, &TX_.default_termios) == -1) {
+        tx_error("Failed to save default state of terminal");
+        return false;
+    }
+
+    atexit(tx_disable_raw_mode_);
+
+    struct termios raw = TX_.default_termios;
+    raw.c_iflag     &= ~(BRKINT | ICRNL | INPCK | IXON);
+    raw.c_oflag     &= ~(OPOST);
+    raw.c_cflag     |= (CS8);
+    raw.c_lflag     &= ~(ECHO | ICANON | IEXTEN | ISIG);
+    raw.c_cc[VMIN]  = 0;
+    raw.c_cc[VTIME] = 0;
+
+    if (tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw) == -1) {
+        tx_error("Failed to enable raw mode");
+        return false;
+    }
+
+    tx_enter_alt_screen_();
+
+    return true;
+}
+
+static void tx_disable_raw_mode_(void) {
+    // The rest of the last frame has to land before the terminal is reset
+    tx_drain_pending_(true);
+
+    if (TX_.mouse_mode != TxMouseMode_OFF) {
+        tx_set_mouse_mode(TxMouseMode_OFF);
+    }
+#ifndef __APPLE__
+    printf("\x1b[<u");
+#endif
+    tcsetattr(STDIN_FILENO, TCSAFLUSH, &TX_.default_termios);
+    tx_exit_alt_screen_();
+    tx_show_cursor_();
+}
+
+static void tx_enter_alt_screen_(void) {
+    tx_drain_pending_(true);
+    printf("\x1b[?1049h");
+}
+
+static void tx_exit_alt_screen_(void) {
+    tx_drain_pending_(true);
+    printf("\x1b[?1049l");
+}
+
+static void tx_hide_cursor_(void) {
+    tx_drain_pending_(true);
+    printf("\033[?25l");
+}
+
+static void tx_show_cursor_(void) {
+    tx_drain_pending_(true);
+    printf("\033[?25h");
+}
+
+static bool tx_get_screen_size_(uint16_t *w, uint16_t *h) {
+    int fd = open("/dev/tty", O_RDWR);
+    if (fd < 0) {
+        tx_error("Failed to open terminal file");
+        return false;
+    }
+
+    struct winsize ws;
+    int r = ioctl(fd, TIOCGWINSZ, &ws);
+    if (r < 0) {
+        tx_error("Failed to read size of terminal");
+        close(fd);
+        return false;
+    }
+
+    *w = ws.ws_col - 1;
+    *h = ws.ws_row - 1;
+
+    close(fd);
+    return true;
+}
+
+static TxVector tx_round_pos_(TxVector p) {
+    return (TxVector) {
+        roundf(p.x),
+        roundf(p.y),
+        p.z,
+    };
+}
+
+static int tx_pos_to_idx_(TxVector p) {
+    int x = (int)roundf(p.x);
+    int y = (int)roundf(p.y);
+    return x + y * TX_.screen_width;
+}
+
+/// Decodes one UTF-8 character. Returns its length in bytes, always at least 1 so
+/// callers make progress over invalid input, which decodes as U+FFFD.
+static int tx_utf8_decode_(const char *s, int len, uint32_t *c) {
+    const uint8_t *b = (const uint8_t *)s;
+
+    int n;
+    if      (b[0] < 0x80)           { *c = b[0];        return 1; }
+    else if ((b[0] & 0xE0) == 0xC0) { *c = b[0] & 0x1F; n = 2; }
+    else if ((b[0] & 0xF0) == 0xE0) { *c = b[0] & 0x0F; n = 3; }
+    else if ((b[0] & 0xF8) == 0xF0) { *c = b[0] & 0x07; n = 4; }
+    else                            { *c = 0xFFFD;      return 1; }
+
+    if (n > len) {
+        *c = 0xFFFD;
+        return 1;
+    }
+
+    for (int i = 1; i < n; i++) {
+        if ((b[i] & 0xC0) != 0x80) {
+            *c = 0xFFFD;
+            return i;
+        }
+        *c = (*c << 6) | (b[i] & 0x3F);
+    }
+    return n;
+}
+
+static void tx_text_input_apply_key_(TxTextInput *ti, int key) {
+    switch (key) {
+        case TxKeyCode_BACKSPACE:   tx_text_input_delete_back(ti);          break;
+        case TxKeyCode_DELETE:      tx_text_input_delete_forward(ti);       break;
+        case TxKeyCode_ARROW_LEFT:  tx_text_input_move(ti, -1);             break;
+        case TxKeyCode_ARROW_RIGHT: tx_text_input_move(ti, 1);              break;
+        case TxKeyCode_HOME:        tx_text_input_move(ti, INT32_MIN);      break;
+        case TxKeyCode_END:         tx_text_input_move(ti, INT32_MAX);      break;
+    }
+}
+
+/// Returns the index of the character before `i`
+static uint32_t tx_text_input_prev_(const TxTextInput *ti, uint32_t i) {
+    do {
+        i--;
+    } while (i > 0 && (tx_text_input_byte_(ti, i) & 0xC0) == 0x80);
+    return i;
+}
+
+static uint32_t tx_text_input_byte_(const TxTextInput *ti, uint32_t i) {
+    return (uint8_t)ti->buf[i < ti->gap_start ? i : i + (ti->gap_end - ti->gap_start)];
+}
+
+/// Returns the index after the character at `i`, decoding it into `c` if given
+static uint32_t tx_text_input_next_(const TxTextInput *ti, uint32_t i, uint32_t *c) {
+    // The gap only ever sits between characters, so one never straddles it
+    uint32_t phys  = i < ti->gap_start ? i : i + (ti->gap_end - ti->gap_start);
+    uint32_t limit = i < ti->gap_start ? ti->gap_start : ti->cap;
+
+    uint32_t cp = 0;
+    int n = tx_utf8_decode_(ti->buf + phys, (int)(limit - phys), &cp);
+    if (c) *c = cp;
+    return i + (uint32_t)n;
+}
+
+static void tx_text_input_move_gap_(TxTextInput *ti, uint32_t i) {
+    if (i < ti->gap_start) {
+        uint32_t n = ti->gap_start - i;
+        memmove(ti->buf + ti->gap_end - n, ti->buf + i, n);
+        ti->gap_start -= n;
+        ti->gap_end   -= n;
+    } else if (i > ti->gap_start) {
+        uint32_t n = i - ti->gap_start;
+        memmove(ti->buf + ti->gap_start, ti->buf + ti->gap_end, n);
+        ti->gap_start += n;
+        ti->gap_end   += n;
+    }
+}
+
+static bool tx_text_input_reserve_(TxTextInput *ti, uint32_t len) {
+    if (ti->gap_end - ti->gap_start >= len) return true;
+
+    uint32_t used = tx_text_input_length(ti);
+    uint32_t cap  = ti->cap ? ti->cap : 64;
+    while (cap - used < len) cap *= 2;
+
+    char *buf = tx_realloc_(ti->buf, cap);
+    if (!buf) {
+        tx_error("Failed to grow text input");
+        return false;
+    }
+
+    // Keep the text after the gap at the end of the buffer
+    uint32_t after = ti->cap - ti->gap_end;
+    memmove(buf + cap - after, buf + ti->gap_end, after);
+
+    ti->buf     = buf;
+    ti->gap_end = cap - after;
+    ti->cap     = cap;
+    return true;
+}
+
+static void *tx_scroll_index_run_(void *arg) {
+    enum { BLOCK = 1 << 20 };
+
+    struct TxScrollIndex_ *idx = arg;
+    uint64_t lines = 0, entries = 0;
+    size_t   o     = 0;
+
+    while (o < idx->size && !atomic_load_explicit(&idx->stop, memory_order_relaxed)) {
+        size_t block_end = o + BLOCK < idx->size ? o + BLOCK : idx->size;
+
+        // `o` is always the start of line number `lines`
+        while (o < block_end) {
+            if (lines % idx->stride == 0) {
+                uint64_t chunk = entries / TX_SCROLL_INDEX_CHUNK_;
+                if (!idx->chunks[chunk]) {
+                    idx->chunks[chunk] = tx_alloc_(TX_SCROLL_INDEX_CHUNK_ * sizeof(uint64_t));
+                    if (!idx->chunks[chunk]) {
+                        tx_error("Failed to grow line index");
+                        atomic_store(&idx->done, true);
+                        return NULL;
+                    }
+                }
+                idx->chunks[chunk][entries % TX_SCROLL_INDEX_CHUNK_] = o;
+                atomic_store_explicit(&idx->entries, ++entries, memory_order_release);
+            }
+
+            const char *nl = memchr(idx->data + o, '\n', idx->size - o);
+            o = nl ? (size_t)(nl - idx->data) + 1 : idx->size;
+            lines++;
+        }
+
+        atomic_store_explicit(&idx->lines, lines, memory_order_release);
+    }
+
+    atomic_store_explicit(&idx->done, true, memory_order_release);
+    return NULL;
+}
+
+/// Returns the start of the line after the one starting at `o`, or the file size
+static size_t tx_scroll_next_line_(const TxScrollView *sv, size_t o) {
+    // An empty file isn't mapped, so `data` may be NULL
+    if (o >= sv->size) return sv->size;
+
+    const char *nl = memchr(sv->data + o, '\n', sv->size - o);
+    return nl ? (size_t)(nl - sv->data) + 1 : sv->size;
+}
+
+/// Returns the start of the line before the one starting at `o`. `o` must be > 0
+static size_t tx_scroll_prev_line_(const TxScrollView *sv, size_t o) {
+    size_t i = o - 1;
+    while (i > 0 && sv->data[i - 1] != '\n') i--;
+    return i;
+}
+
+static TxDrawCommand *tx_draw_list_push_(TxDrawList *dl, TxDrawCommandKind kind, TxVector pos) {
+    if (dl->count == dl->cap) {
+        uint32_t cap = dl->cap ? dl->cap * 2 : 64;
+        void *cmds = tx_realloc_(dl->cmds, cap * sizeof(*dl->cmds));
+        if (!cmds) {
+            tx_error("Failed to grow draw list");
+            return NULL;
+        }
+        dl->cmds = cmds;
+        dl->cap  = cap;
+    }
+
+    dl->sorted = false;
+    TxDrawCommand *cmd = &dl->cmds[dl->count++];
+    *cmd = (TxDrawCommand){.kind = kind, .pos = pos, .fg = dl->fg, .bg = dl->bg};
+    return cmd;
+}
+
+static bool tx_draw_list_reserve_data_(TxDrawList *dl, uint32_t len) {
+    if (dl->data_len + len <= dl->data_cap) return true;
+
+    uint32_t cap = dl->data_cap ? dl->data_cap : 256;
+    while (cap < dl->data_len + len) cap *= 2;
+
+    char *data = tx_realloc_(dl->data, cap);
+    if (!data) {
+        tx_error("Failed to grow draw list data");
+        return false;
+    }
+    dl->data     = data;
+    dl->data_cap = cap;
+    return true;
+}
+
+static int tx_compare_sort_keys_(const void *a, const void *b) {
+    const struct TxDrawSortKey *ka = a, *kb = b;
+    if (ka->z != kb->z) return ka->z < kb->z ? -1 : 1;
+    return ka->index < kb->index ? -1 : ka->index > kb->index;
+}
+
+/// Same shape as tx_draw_rec/tx_fill_rec, plotted without touching the depth buffer
+static void tx_raster_rec_(TxRectangle rec, const uint32_t *palette, bool fill) {
+    int min_x = (int)roundf(rec.pos.x), max_x = (int)roundf(rec.pos.x + rec.size.x);
+    int min_y = (int)roundf(rec.pos.y), max_y = (int)roundf(rec.pos.y + rec.size.y);
+
+    // Outline palette indices: horizontal top/bottom, vertical left/right, corners
+    int top = 0, bottom = 0, left = 1, right = 1, tl = 2, tr = 3, bl = 4, br = 5;
+    if (fill) {
+        top = 0; bottom = 1; left = 3; right = 2; tl = 5; tr = 6; bl = 7; br = 8;
+    }
+
+    tx_plot_(palette[tl], min_x, min_y);
+    tx_plot_(palette[tr], max_x, min_y);
+    tx_plot_(palette[bl], min_x, max_y);
+    tx_plot_(palette[br], max_x, max_y);
+
+    for (int y = min_y + 1; y < max_y; y++) {
+        tx_plot_(palette[left],  min_x, y);
+        tx_plot_(palette[right], max_x, y);
+    }
+
+    for (int x = min_x + 1; x < max_x; x++) {
+        tx_plot_(palette[top],    x, min_y);
+        tx_plot_(palette[bottom], x, max_y);
+    }
+
+    if (fill) {
+        for (int y = min_y + 1; y < max_y; y++) {
+            for (int x = min_x + 1; x < max_x; x++) {
+                tx_plot_(palette[4], x, y);
+            }
+        }
+    }
+}
+
+static void tx_plot_(uint32_t c, int x, int y) {
+    if (x < 0 || y < 0 || x >= TX_.screen_width || y >= TX_.screen_height) return;
+    tx_put_cell_(x + y * TX_.screen_width, c);
+}
+
+static int tx_set_cell_(int idx, uint32_t c, float z) {
+    int w = tx_put_cell_(idx, c);
+    for (int i = 0; i < w; i++) {
+        TX_.depth_buffer[idx + i] = z;
+    }
+    return w;
+}
+
+/// Writes a character to the screen, keeping wide characters whole. Returns how many
+/// cells it took up.
+static int tx_put_cell_(int idx, uint32_t c) {
+    uint32_t *cell = TX_.screen + idx;
+    bool room = idx % TX_.screen_width + 1 < TX_.screen_width;
+
+    // Overwriting either half of a wide character blanks the other half, like terminals do
+    if (cell[0] == TX_WIDE_TAIL_) {
+        cell[-1] = 0;
+    } else if (room && cell[1] == TX_WIDE_TAIL_) {
+        cell[1] = 0;
+    }
+
+    TX_.fg[idx] = TX_.draw_fg;
+    TX_.bg[idx] = TX_.draw_bg;
+
+    if (tx_char_width(c) != 2) {
+        cell[0] = c;
+        return 1;
+    }
+
+    // Terminals would wrap it to the next line instead
+    if (!room) {
+        cell[0] = ' ';
+        return 1;
+    }
+
+    if (idx % TX_.screen_width + 2 < TX_.screen_width && cell[2] == TX_WIDE_TAIL_) {
+        cell[2] = 0;
+    }
+    cell[0] = c;
+    cell[1] = TX_WIDE_TAIL_;
+    TX_.fg[idx + 1] = TX_.draw_fg;
+    TX_.bg[idx + 1] = TX_.draw_bg;
+    return 2;
+}
+
+static int tx_codepoint_length_(uint32_t c) {
+    if (c <= 0x7F) {
+        return 1;
+    } else if (c <= 0x7FF) {
+        return 2;
+    } else if (c <= 0xFFFF) {
+        return 3;
+    } else if (c <= 0x10FFFF) {
+        return 4;
+    } else {
+        return 0;
+    }
+}
+
+static void tx_move_cursor_to_origin_(void) {
+    tx_out_append_("\x1b[H", 3);
+}
+
+static bool tx_out_reserve_(size_t len) {
+    if (TX_.out_len + len <= TX_.out_cap) return true;
+
+#ifndef TX_MAX_WIDTH
+    size_t cap = TX_.out_cap ? TX_.out_cap : 256;
+    while (cap < TX_.out_len + len) cap *= 2;
+
+    char *out = tx_realloc_(TX_.out, cap);
+    if (out) {
+        TX_.out     = out;
+        TX_.out_cap = cap;
+        return true;
+    }
+#endif
+
+    // Can't grow, so send what's encoded so far to make room
+    tx_out_flush_();
+    return len <= TX_.out_cap;
+}
+
+static void tx_out_append_(const char *s, size_t len) {
+    if (!tx_out_reserve_(len)) return;
+    memcpy(TX_.out + TX_.out_len, s, len);
+    TX_.out_len += len;
+}
+
+static void tx_out_flush_(void) {
+    // Sinks are walked backwards so one that gets dropped is replaced by one already visited
+    if (TX_.out_to_sinks) {
+        for (int i = TX_.sink_count - 1; i >= 0; i--) {
+            struct TxSink_ *sink = &TX_.sinks[i];
+            if (!sink->synced && sink->resync_ok && !tx_sink_write_(sink->fd, TX_.out, TX_.out_len)) {
+                if (!tx_sink_failed_(i)) sink->resync_ok = false;
+            }
+        }
+        TX_.out_len = 0;
+        return;
+    }
+
+    tx_out_send_(TX_.out, TX_.out_len);
+    tx_record_('o', TX_.out, TX_.out_len);
+
+    for (int i = TX_.sink_count - 1; i >= 0; i--) {
+        if (TX_.sinks[i].synced && !tx_sink_write_(TX_.sinks[i].fd, TX_.out, TX_.out_len)) {
+            if (tx_sink_failed_(i)) continue;
+            TX_.sinks[i].synced = false;
+            TX_.stats.sink_drops++;
+        }
+    }
+    TX_.out_len = 0;
+}
+
+static void tx_out_cell_(int idx) {
+    uint32_t c = TX_.screen[idx];
+
+    // The wide character to the left already covers this column
+    if (c == TX_WIDE_TAIL_) return;
+
+    tx_out_colors_(TX_.fg[idx], TX_.bg[idx], idx % TX_.screen_width, idx / TX_.screen_width);
+
+    char cbuf[5];
+    if (tx_char_width(c) == 0) {
+        TX_.out[TX_.out_len++] = ' ';
+    } else if (tx_to_utf8(c, cbuf)) {
+        for (char *b = cbuf; *b; b++) TX_.out[TX_.out_len++] = *b;
+    } else {
+        tx_error("Failed to encode character to UTF-8: 0x%X", c);
+        TX_.out[TX_.out_len++] = '?';
+    }
+}
+
+/// Sets the terminal's colours for the next cell, only sending what changed
+static void tx_out_colors_(TxColor fg, TxColor bg, int x, int y) {
+    if (TX_.color_depth == TxColorDepth_NONE) return;
+
+    uint32_t pen_fg = tx_reduce_color_(fg, x, y);
+    uint32_t pen_bg = tx_reduce_color_(bg, x, y);
+    if (pen_fg == TX_.pen_fg && pen_bg == TX_.pen_bg) return;
+
+    char *out = TX_.out + TX_.out_len;
+    int   n   = 0;
+    out[n++] = '\x1b';
+    out[n++] = '[';
+    if (pen_fg != TX_.pen_fg) {
+        n += tx_sgr_color_(out + n, pen_fg, false);
+    }
+    if (pen_bg != TX_.pen_bg) {
+        if (pen_fg != TX_.pen_fg) out[n++] = ';';
+        n += tx_sgr_color_(out + n, pen_bg, true);
+    }
+    out[n++] = 'm';
+
+    TX_.out_len += (size_t)n;
+    TX_.pen_fg   = pen_fg;
+    TX_.pen_bg   = pen_bg;
+}
+
+/// Writes the SGR parameters selecting a colour reduced by tx_reduce_color_
+static int tx_sgr_color_(char *buf, TxColor pen, bool bg) {
+    int base = bg ? 40 : 30;
+    if (pen == TxColor_DEFAULT) {
+        return sprintf(buf, "%d", base + 9);
+    }
+
+    uint32_t v = pen & 0xFFFFFF;
+    switch (TX_.color_depth) {
+        case TxColorDepth_TRUE:
+            return sprintf(buf, "%d;2;%u;%u;%u", base + 8, (unsigned)(v >> 16), (unsigned)(v >> 8) & 0xFF, (unsigned)v & 0xFF);
+        case TxColorDepth_256:
+            return sprintf(buf, "%d;5;%u", base + 8, (unsigned)v);
+        default:
+            return sprintf(buf, "%u", v < 8 ? base + v : base + 60 + v - 8);
+    }
+}
+
+/// Maps a colour to what gets sent for it: the colour itself for truecolor terminals,
+/// otherwise the nearest palette index, tagged so it can't be mistaken for the default.
+static uint32_t tx_reduce_color_(TxColor c, int x, int y) {
+    if (c == TxColor_DEFAULT || TX_.color_depth == TxColorDepth_TRUE) return c;
+
+    int r = (c >> 16) & 0xFF, g = (c >> 8) & 0xFF, b = c & 0xFF;
+
+    // Nudge each channel by up to half a palette step so neighbouring cells round
+    // differently and average out to the colour in between
+    if (TX_.dither) {
+        int step = TX_.color_depth == TxColorDepth_256 ? 40 : 128;
+        int d    = ((int)tx_bayer_4x4_[y & 3][x & 3] * 2 - 15) * step / 32;
+        r += d; g += d; b += d;
+        r = r < 0 ? 0 : r > 255 ? 255 : r;
+        g = g < 0 ? 0 : g > 255 ? 255 : g;
+        b = b < 0 ? 0 : b > 255 ? 255 : b;
+    }
+
+    enum { SHIFT = 8 - TX_COLOR_LUT_BITS_ };
+    int key = (r >> SHIFT) << (2 * TX_COLOR_LUT_BITS_) | (g >> SHIFT) << TX_COLOR_LUT_BITS_ | (b >> SHIFT);
+    return 0x01000000u | TX_.color_lut[key];
+}
+
+/// Finds the nearest palette colour for every bucket of the lookup table once, so
+/// reducing a colour while rendering is a single load
+static void tx_build_color_lut_(void) {
+    if (TX_.color_depth != TxColorDepth_16 && TX_.color_depth != TxColorDepth_256) return;
+
+    enum { N = 1 << TX_COLOR_LUT_BITS_, SHIFT = 8 - TX_COLOR_LUT_BITS_ };
+    for (int key = 0; key < N * N * N; key++) {
+        // Centre of the bucket
+        int r = ((key >> (2 * TX_COLOR_LUT_BITS_))    << SHIFT) + (1 << SHIFT) / 2;
+        int g = (((key >> TX_COLOR_LUT_BITS_) & (N - 1)) << SHIFT) + (1 << SHIFT) / 2;
+        int b = ((key & (N - 1))                      << SHIFT) + (1 << SHIFT) / 2;
+
+        if (TX_.color_depth == TxColorDepth_16) {
+            int best = 0, best_dist = INT32_MAX;
+            for (int i = 0; i < 16; i++) {
+                const uint8_t *p = tx_ansi_palette_[i];
+                int dist = tx_color_dist_(r, g, b, p[0], p[1], p[2]);
+                if (dist < best_dist) best = i, best_dist = dist;
+            }
+            TX_.color_lut[key] = (uint8_t)best;
+            continue;
+        }
+
+        // The nearest colour is either in the cube or on the grey ramp, and the nearest
+        // cube level can be found per channel
+        int ci[3], in[3] = {r, g, b};
+        for (int k = 0; k < 3; k++) {
+            ci[k] = in[k] < 48 ? 0 : in[k] < 115 ? 1 : (in[k] - 35) / 40;
+        }
+        int cube_dist = tx_color_dist_(r, g, b, tx_cube_levels_[ci[0]], tx_cube_levels_[ci[1]], tx_cube_levels_[ci[2]]);
+
+        int avg   = (2 * r + 4 * g + 3 * b) / 9;
+        int gi    = avg < 8 ? 0 : avg > 238 ? 23 : (avg - 3) / 10;
+        int level = 8 + gi * 10;
+        int grey_dist = tx_color_dist_(r, g, b, level, level, level);
+
+        TX_.color_lut[key] = grey_dist < cube_dist
+            ? (uint8_t)(232 + gi)
+            : (uint8_t)(16 + ci[0] * 36 + ci[1] * 6 + ci[2]);
+    }
+}
+
+/// Packs two rows of pixels into half block colours. Kept free of branches and aliasing
+/// so the compiler can vectorize it
+static void tx_pack_half_blocks_(TxColor *restrict fg, TxColor *restrict bg, const uint32_t *restrict top, const uint32_t *restrict bottom, int n) {
+    for (int i = 0; i < n; i++) {
+        fg[i] = 0x01000000u | (top[i] & 0xFFFFFF);
+        bg[i] = 0x01000000u | (bottom[i] & 0xFFFFFF);
+    }
+}
+
+static void tx_pack_half_blocks_mapped_(TxColor *restrict fg, TxColor *restrict bg, const uint32_t *restrict top, const uint32_t *restrict bottom, const int *restrict xmap, int n) {
+    for (int i = 0; i < n; i++) {
+        fg[i] = 0x01000000u | (top[xmap[i]] & 0xFFFFFF);
+        bg[i] = 0x01000000u | (bottom[xmap[i]] & 0xFFFFFF);
+    }
+}
+
+static TxColor tx_keep_close_color_(TxColor old, TxColor c, int tolerance) {
+    if (old == TxColor_DEFAULT) return c;
+
+    for (int shift = 0; shift < 24; shift += 8) {
+        int d = (int)((old >> shift) & 0xFF) - (int)((c >> shift) & 0xFF);
+        if (d > tolerance || d < -tolerance) return c;
+    }
+    return old;
+}
+
+/// Distance between colours, weighted towards green which the eye is most sensitive to
+static int tx_color_dist_(int r0, int g0, int b0, int r1, int g1, int b1) {
+    return 2 * (r1 - r0) * (r1 - r0) + 4 * (g1 - g0) * (g1 - g0) + 3 * (b1 - b0) * (b1 - b0);
+}
+
+static TxColorDepth tx_detect_color_depth_(void) {
+    const char *no_color  = getenv("NO_COLOR");
+    const char *colorterm = getenv("COLORTERM");
+    const char *term      = getenv("TERM");
+
+    if (no_color && no_color[0]) return TxColorDepth_NONE;
+    if (colorterm && (strcmp(colorterm, "truecolor") == 0 || strcmp(colorterm, "24bit") == 0)) {
+        return TxColorDepth_TRUE;
+    }
+    if (!term || strcmp(term, "dumb") == 0) return TxColorDepth_NONE;
+    if (strstr(term, "direct"))             return TxColorDepth_TRUE;
+    if (strstr(term, "256color"))           return TxColorDepth_256;
+    return TxColorDepth_16;
+}
+
+/// Puts the terminal back to default colours so every frame starts from the same state,
+/// whichever stream it goes to
+static void tx_out_reset_colors_(void) {
+    if (TX_.pen_fg == TxColor_DEFAULT && TX_.pen_bg == TxColor_DEFAULT) return;
+    tx_out_append_("\x1b[0m", 4);
+    TX_.pen_fg = TxColor_DEFAULT;
+    TX_.pen_bg = TxColor_DEFAULT;
+}
+
+static void tx_encode_keyframe_(void) {
+    tx_move_cursor_to_origin_();
+
+    for (int y = 0; y < TX_.screen_height; y++) {
+        for (int x = 0; x < TX_.screen_width; x++) {
+            if (!tx_out_reserve_(TX_CELL_MAX_BYTES_)) {
+                tx_error("Output buffer too small for a cell");
+                return;
+            }
+            tx_out_cell_(x + y * TX_.screen_width);
+        }
+
+        // A newline after the last row would scroll the screen
+        if (y + 1 < TX_.screen_height) tx_out_append_("\r\n", 2);
+    }
+    tx_out_reset_colors_();
+
+    if (!TX_.out_to_sinks) {
+        size_t cells = (size_t)TX_.screen_width * TX_.screen_height;
+        memcpy(TX_.front, TX_.screen, cells * sizeof(*TX_.front));
+        memcpy(TX_.front_fg, TX_.fg, cells * sizeof(*TX_.front_fg));
+        memcpy(TX_.front_bg, TX_.bg, cells * sizeof(*TX_.front_bg));
+    }
+}
+
+static void tx_encode_delta_(void) {
+    // Re-sending a few unchanged cells is cheaper than a cursor move
+    enum { MAX_GAP = 4 };
+
+    for (int y = 0; y < TX_.screen_height; y++) {
+        int row    = y * TX_.screen_width;
+        int cursor = -1 - MAX_GAP; // Column the terminal cursor is at, if on this row
+
+        for (int x = 0; x < TX_.screen_width; x++) {
+            int i = row + x;
+            if (TX_.screen[i] == TX_.front[i] && TX_.fg[i] == TX_.front_fg[i] && TX_.bg[i] == TX_.front_bg[i]) {
+                continue;
+            }
+
+            if (!tx_out_reserve_(16 + (MAX_GAP + 1) * TX_CELL_MAX_BYTES_)) return;
+
+            if (x != cursor) {
+                if (cursor >= 0 && x - cursor <= MAX_GAP) {
+                    for (; cursor < x; cursor++) tx_out_cell_(row + cursor);
+                } else {
+                    TX_.out_len += (size_t)snprintf(TX_.out + TX_.out_len, 16, "\x1b[%d;%dH", y + 1, x + 1);
+                }
+            }
+
+            tx_out_cell_(i);
+            TX_.front[i]    = TX_.screen[i];
+            TX_.front_fg[i] = TX_.fg[i];
+            TX_.front_bg[i] = TX_.bg[i];
+            cursor = x + 1;
+        }
+    }
+    tx_out_reset_colors_();
+}
+
+static void tx_accept_sinks_(void) {
+    if (TX_.sink_listener < 0) return;
+
+    for (int fd; (fd = accept(TX_.sink_listener, NULL, NULL)) >= 0;) {
+        if (tx_add_sink(fd)) {
+            TX_.sinks[TX_.sink_count - 1].owned = true;
+        } else {
+            close(fd);
+        }
+    }
+}
+
+/// Writes without blocking. A short write leaves the sink mid-frame, so it needs a keyframe
+static bool tx_sink_write_(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+#ifdef MSG_NOSIGNAL
+        ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == ENOTSOCK) n = tx_write_no_sigpipe_(fd, buf, len);
+#else
+        ssize_t n = tx_write_no_sigpipe_(fd, buf, len);
+#endif
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) return false;
+        if (n == 0) {
+            errno = EAGAIN;
+            return false;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+/// Writes to a pipe or socket whose reader may be gone, getting EPIPE instead of being
+/// killed by SIGPIPE
+static ssize_t tx_write_no_sigpipe_(int fd, const char *buf, size_t len) {
+    sigset_t pipe_set, old_mask, pending;
+    sigemptyset(&pipe_set);
+    sigaddset(&pipe_set, SIGPIPE);
+
+    sigpending(&pending);
+    bool was_pending = sigismember(&pending, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipe_set, &old_mask);
+
+    ssize_t n = write(fd, buf, len);
+    int     err = errno;
+
+    // Take the signal the write raised while it's still blocked, leaving any earlier one be
+    if (n < 0 && err == EPIPE && !was_pending) {
+        sigpending(&pending);
+        int sig;
+        if (sigismember(&pending, SIGPIPE)) sigwait(&pipe_set, &sig);
+    }
+
+    pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+    errno = err;
+    return n;
+}
+
+/// Called after a failed write to sink `i`. A sink that's only slow is kept for a resync, but
+/// one that's gone (EPIPE, ECONNRESET, EBADF, ...) is removed. Returns whether it was removed
+static bool tx_sink_failed_(int i) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) return false;
+
+    if (TX_.sinks[i].owned) close(TX_.sinks[i].fd);
+    TX_.sinks[i] = TX_.sinks[--TX_.sink_count];
+    return true;
+}
+
+static bool tx_write_all_(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                poll(&(struct pollfd){.fd = fd, .events = POLLOUT}, 1, -1);
+                continue;
+            }
+            return false;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+/// Writes as much as `fd` takes without blocking. The fd is only non-blocking for the
+/// duration of the call, since stdin and stdio usually share it and expect blocking writes.
+static size_t tx_write_some_(int fd, const char *buf, size_t len) {
+    int flags = fcntl(fd, F_GETFL);
+    if (flags >= 0 && !(flags & O_NONBLOCK)) fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = write(fd, buf + done, len - done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                // Nothing will ever take these bytes, so don't hold later frames back for them
+                tx_error("Failed to write to terminal: %s", strerror(errno));
+                done = len;
+            }
             break;
         }
-        tx_set_cell_(idx, text[i], pos.z);
-        idx++;
+        done += (size_t)n;
     }
-}
 
-void tx_set_log_level(TxLogLevel lv) {
-    TX_.log_level = lv;
+    if (flags >= 0 && !(flags & O_NONBLOCK)) fcntl(fd, F_SETFL, flags);
+    return done;
 }
 
-void tx_log(TxLogLevel lv, const char *restrict fmt, ...) {
-    static const char *level_labels[TxLogLevel_COUNT] = {
-        [TxLogLevel_ALL]   = "LOG",
-        [TxLogLevel_DEBUG] = "DEBUG",
-        [TxLogLevel_INFO]  = "INFO",
-        [TxLogLevel_ERROR] = "ERROR",
-    };
+/// Sends output to the terminal, keeping whatever it won't take yet for later
+static void tx_out_send_(const char *buf, size_t len) {
+    if (TX_.pending_len == 0) {
+        // Control sequences written through stdio must reach the terminal first
+        fflush(stdout);
 
-    if (lv >= TxLogLevel_NONE) return;
+        size_t n = tx_write_some_(STDOUT_FILENO, buf, len);
+        TX_.stats.bytes_written += n;
+        buf += n;
+        len -= n;
+        if (len == 0) return;
+    }
 
-    va_list args;
-    va_start(args, fmt);
-    {
-        fprintf(stderr, "%s: ", level_labels[lv]);
-        vfprintf(stderr, fmt, args);
-        fprintf(stderr, "\n");
+    if (TX_.pending_len + len > TX_.pending_cap) {
+#ifndef TX_MAX_WIDTH
+        size_t cap = TX_.pending_cap ? TX_.pending_cap : 4096;
+        while (cap < TX_.pending_len + len) cap *= 2;
+
+        char *pending = tx_realloc_(TX_.pending, cap);
+        if (pending) {
+            TX_.pending     = pending;
+            TX_.pending_cap = cap;
+        }
+#endif
     }
-    va_end(args);
+
+    // Out of room, so there's no choice but to wait for the terminal
+    if (TX_.pending_len + len > TX_.pending_cap) {
+        tx_drain_pending_(true);
+        tx_write_all_(STDOUT_FILENO, buf, len);
+        TX_.stats.bytes_written += len;
+        return;
+    }
+
+    memcpy(TX_.pending + TX_.pending_len, buf, len);
+    TX_.pending_len += len;
 }
 
-bool tx_to_utf8(uint32_t c, char buf[static 5]) {
-    memset(buf, 0, 5);
+static void tx_drain_pending_(bool block) {
+    if (TX_.pending_len == 0) return;
 
-    int clen = tx_codepoint_length_(c);
-    if (clen == 0) {
-        return false;
+    size_t n = TX_.pending_len;
+    if (block) {
+        tx_write_all_(STDOUT_FILENO, TX_.pending, n);
+    } else {
+        n = tx_write_some_(STDOUT_FILENO, TX_.pending, n);
     }
 
-    switch (clen) {
-        case 1:
-            buf[0] = c & 0x7F;
-            break;
-        case 2:
-            buf[0] = 0xC0 | ((c >> 6) & 0x1F);
-            buf[1] = 0x80 | (c & 0x3F);
-            break;
-        case 3:
-            buf[0] = 0xE0 | ((c >> 12) & 0x0F);
-            buf[1] = 0x80 | ((c >> 6) & 0x3F);
-            buf[2] = 0x80 | (c & 0x3F);
-            break;
-        case 4:
-            buf[0] = 0xF0 | ((c >> 18) & 0x07);
-            buf[1] = 0x80 | ((c >> 12) & 0x3F);
-            buf[2] = 0x80 | ((c >> 6) & 0x3F);
-            buf[3] = 0x80 | (c & 0x3F);
-            break;
+    memmove(TX_.pending, TX_.pending + n, TX_.pending_len - n);
+    TX_.pending_len         -= n;
+    TX_.stats.bytes_written += n;
+}
+
+/// Tests whether the terminal is still busy with earlier output
+static bool tx_output_backlogged_(void) {
+    if (TX_.pending_len > 0) return true;
+
+#ifdef TIOCOUTQ
+    // Bytes the tty has accepted but not yet handed on, e.g. to a slow ssh connection
+    int queued = 0;
+    if (ioctl(STDOUT_FILENO, TIOCOUTQ, &queued) == 0 && queued > TX_OUTPUT_QUEUE_LIMIT) {
+        return true;
     }
+#endif
 
-    return true;
+    return false;
 }
 
-TxVector TxVector_add(TxVector a, TxVector b) {
-    return (TxVector) {
-        .x = a.x + b.x,
-        .y = a.y + b.y,
-    };
+static void tx_record_(char kind, const char *data, size_t len) {
+    struct TxRecorder_ *rec = TX_.recorder;
+    if (!rec || len == 0) return;
+
+    double   time   = tx_time_now_() - rec->start;
+    uint32_t len32  = (uint32_t)len;
+    size_t   needed = sizeof(time) + sizeof(len32) + 1 + len;
+
+    pthread_mutex_lock(&rec->lock);
+    if (rec->used + needed > rec->cap) {
+        // Never wait on the disk from the frame path
+        rec->dropped++;
+    } else {
+        tx_recorder_put_(rec, &time, sizeof(time));
+        tx_recorder_put_(rec, &len32, sizeof(len32));
+        tx_recorder_put_(rec, &kind, 1);
+        tx_recorder_put_(rec, data, len);
+        pthread_cond_signal(&rec->wake);
+    }
+    pthread_mutex_unlock(&rec->lock);
 }
 
-TxVector TxVector_mul(TxVector a, TxVector b) {
-    return (TxVector) {
-        .x = a.x * b.x,
-        .y = a.y * b.y,
-    };
+static void tx_recorder_put_(struct TxRecorder_ *rec, const void *data, size_t len) {
+    size_t at    = (rec->head + rec->used) % rec->cap;
+    size_t first = len < rec->cap - at ? len : rec->cap - at;
+    memcpy(rec->ring + at, data, first);
+    memcpy(rec->ring, (const char *)data + first, len - first);
+    rec->used += len;
 }
 
-static bool tx_enable_raw_mode_(void) {
-    if (tcgetattr(STDIN_FILENO, &TX_.default_termios) == -1) {
-        tx_error("Failed to save default state of terminal");
-        return false;
-    }
+static void tx_recorder_get_(struct TxRecorder_ *rec, void *data, size_t len) {
+    size_t first = len < rec->cap - rec->head ? len : rec->cap - rec->head;
+    memcpy(data, rec->ring + rec->head, first);
+    memcpy((char *)data + first, rec->ring, len - first);
+    rec->head = (rec->head + len) % rec->cap;
+    rec->used -= len;
+}
 
-    atexit(tx_disable_raw_mode_);
+static void *tx_recorder_run_(void *arg) {
+    struct TxRecorder_ *rec = arg;
 
-    struct termios raw = TX_.default_termios;
-    raw.c_iflag     &= ~(BRKINT | ICRNL | INPCK | IXON);
-    raw.c_oflag     &= ~(OPOST);
-    raw.c_cflag     |= (CS8);
-    raw.c_lflag     &= ~(ECHO | ICANON | IEXTEN | ISIG);
-    raw.c_cc[VMIN]  = 0;
-    raw.c_cc[VTIME] = 0;
+    char * scratch = NULL;
+    size_t scratch_cap = 0;
 
-    if (tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw) == -1) {
-        tx_error("Failed to enable raw mode");
-        return false;
+    pthread_mutex_lock(&rec->lock);
+    for (;;) {
+        while (rec->used == 0 && !rec->stop) {
+            pthread_cond_wait(&rec->wake, &rec->lock);
+        }
+        if (rec->used == 0) break;
+
+        double   time;
+        uint32_t len;
+        char     kind;
+        tx_recorder_get_(rec, &time, sizeof(time));
+        tx_recorder_get_(rec, &len, sizeof(len));
+        tx_recorder_get_(rec, &kind, 1);
+
+        if (scratch_cap < len) {
+            char *grown = tx_realloc_(scratch, len);
+            if (!grown) {
+                // Skip the record rather than stall the recorder
+                char skip[256];
+                for (uint32_t left = len; left > 0;) {
+                    uint32_t n = left < sizeof(skip) ? left : (uint32_t)sizeof(skip);
+                    tx_recorder_get_(rec, skip, n);
+                    left -= n;
+                }
+                continue;
+            }
+            scratch     = grown;
+            scratch_cap = len;
+        }
+        tx_recorder_get_(rec, scratch, len);
+
+        // Escaping and writing happen without holding the lock
+        pthread_mutex_unlock(&rec->lock);
+        fprintf(rec->file, "[%.6f, \"%c\", ", time, kind);
+        tx_write_json_string_(rec->file, scratch, len);
+        fputs("]\n", rec->file);
+        pthread_mutex_lock(&rec->lock);
     }
+    pthread_mutex_unlock(&rec->lock);
 
-    tx_enter_alt_screen_();
+    tx_free_(scratch);
+    return NULL;
+}
 
-    return true;
+static void tx_write_json_string_(FILE *f, const char *s, size_t len) {
+    fputc('"', f);
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = (uint8_t)s[i];
+        switch (c) {
+            case '"':  fputs("\\\"", f); break;
+            case '\\': fputs("\\\\", f); break;
+            case '\n': fputs("\\n", f);  break;
+            case '\r': fputs("\\r", f);  break;
+            case '\t': fputs("\\t", f);  break;
+            default:
+                if (c < 0x20 || c == 0x7F) fprintf(f, "\\u%04x", c);
+                else                       fputc(c, f);
+                break;
+        }
+    }
+    fputc('"', f);
 }
 
-static void tx_disable_raw_mode_(void) {
-    tcsetattr(STDIN_FILENO, TCSAFLUSH, &TX_.default_termios);
-    tx_exit_alt_screen_();
-    tx_show_cursor_();
+/// Decodes the JSON string starting after its opening quote into `out`, which must be at
+/// least as long as the input. Returns the decoded length.
+static size_t tx_parse_json_string_(const char *s, char *out) {
+    size_t n = 0;
+    for (; *s && *s != '"'; s++) {
+        if (*s != '\\') {
+            out[n++] = *s;
+            continue;
+        }
+
+        switch (*++s) {
+            case 'n': out[n++] = '\n'; break;
+            case 'r': out[n++] = '\r'; break;
+            case 't': out[n++] = '\t'; break;
+            case 'b': out[n++] = '\b'; break;
+            case 'f': out[n++] = '\f'; break;
+            case 'u': {
+                unsigned cp = 0;
+                if (sscanf(s + 1, "%4x", &cp) != 1) return n;
+                s += 4;
+
+                // Surrogate pair
+                unsigned lo = 0;
+                if (cp >= 0xD800 && cp < 0xDC00 && s[1] == '\\' && s[2] == 'u' && sscanf(s + 3, "%4x", &lo) == 1) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                    s += 6;
+                }
+
+                char buf[5];
+                if (tx_to_utf8(cp, buf)) {
+                    for (char *b = buf; *b; b++) out[n++] = *b;
+                    if (cp == 0) out[n++] = 0;
+                }
+            } break;
+            case 0:  return n;
+            default: out[n++] = *s; break; // \" \\ and \/
+        }
+    }
+    return n;
 }
 
-static void tx_enter_alt_screen_(void) {
-    printf("\x1b[?1049h");
+static double tx_time_now_(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
 }
 
-static void tx_exit_alt_screen_(void) {
-    printf("\x1b[?1049l");
+static void tx_sleep_until_(double t) {
+#ifdef __APPLE__
+    // No clock_nanosleep, so sleep for the time left instead
+    double wait = t - tx_time_now_();
+    if (wait <= 0) return;
+    struct timespec ts = {.tv_sec = (time_t)wait, .tv_nsec = (long)((wait - (time_t)wait) * 1e9)};
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR) {}
+#else
+    struct timespec ts = {.tv_sec = (time_t)t, .tv_nsec = (long)((t - (time_t)t) * 1e9)};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {}
+#endif
 }
 
-static void tx_hide_cursor_(void) {
-    printf("\033[?25l");
+static void tx_read_input_(void) {
+    for (;;) {
+        // Bytes left over from an earlier frame, like the rest of a large paste, are
+        // decoded whether or not anything new arrives
+        if (TX_.input_len > 0) {
+            int used = tx_decode_input_(TX_.input, TX_.input_len);
+            bool text_full = TX_.text_len + 4 > TX_TEXT_INPUT_SIZE;
+            if (used == 0 && TX_.input_len == TX_INPUT_BUFFER_SIZE && !text_full) {
+                tx_error("Discarding %d bytes of undecodable input", TX_.input_len);
+                used = TX_.input_len;
+            }
+
+            memmove(TX_.input, TX_.input + used, TX_.input_len - used);
+            TX_.input_len -= used;
+
+            // The rest of a large paste stays queued until the next frame
+            if (text_full) break;
+        }
+
+        int cap = TX_INPUT_BUFFER_SIZE - TX_.input_len;
+        ssize_t n = read(STDIN_FILENO, TX_.input + TX_.input_len, cap);
+        if (n <= 0) break;
+        tx_record_('i', (const char *)TX_.input + TX_.input_len, (size_t)n);
+        TX_.input_len += n;
+    }
+
+    // A lone ESC with nothing after it is the escape key, not the start of a sequence
+    if (TX_.input_len == 1 && TX_.input[0] == 0x1B) {
+        tx_key_event_(TxKeyCode_ESC, 0, 0);
+        TX_.input_len = 0;
+    }
+
+    TX_.text[TX_.text_len] = 0;
 }
 
-static void tx_show_cursor_(void) {
-    printf("\033[?25h");
+/// Decodes as many complete key presses and escape sequences as possible.
+/// Returns the number of bytes consumed; an incomplete trailing sequence is left for later.
+static int tx_decode_input_(const uint8_t *buf, int len) {
+    int i = 0;
+    while (i < len) {
+        uint8_t b = buf[i];
+
+        if (b >= 0x80) {
+            // A UTF-8 character is taken whole or not at all, so it's never split across frames
+            int n = b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : b >= 0xC0 ? 2 : 1;
+            int k = 1;
+            while (k < n && i + k < len && (buf[i + k] & 0xC0) == 0x80) k++;
+            if (k < n && i + k == len) break;
+            if (TX_.text_len + k > TX_TEXT_INPUT_SIZE) break;
+
+            memcpy(TX_.text + TX_.text_len, buf + i, k);
+            TX_.text_len += k;
+            i += k;
+            continue;
+        }
+
+        if (b != 0x1B) {
+            if (b >= 0x20 && b != 0x7F && TX_.text_len + 1 > TX_TEXT_INPUT_SIZE) {
+                break;
+            }
+
+            switch (b) {
+                case '\r': tx_key_event_(TxKeyCode_ENTER, 0, 0);     break;
+                case '\t': tx_key_event_(TxKeyCode_TAB, 0, 0);       break;
+                case 0x08:
+                case 0x7F: tx_key_event_(TxKeyCode_BACKSPACE, 0, 0); break;
+                default:
+                    tx_key_event_(b, 0, 0);
+                    if (b >= 0x20) TX_.text[TX_.text_len++] = (char)b;
+                    break;
+            }
+            i++;
+            continue;
+        }
+
+        if (i + 1 >= len) {
+            break;
+        }
+
+        uint8_t next = buf[i + 1];
+        if (next == '[') {
+            int n = tx_decode_csi_(buf + i, len - i);
+            if (n == 0) break;
+            i += n;
+        } else if (next == 'O') {
+            if (i + 2 >= len) break;
+            switch (buf[i + 2]) {
+                case 'A': tx_key_event_(TxKeyCode_ARROW_UP, 0, 0);    break;
+                case 'B': tx_key_event_(TxKeyCode_ARROW_DOWN, 0, 0);  break;
+                case 'C': tx_key_event_(TxKeyCode_ARROW_RIGHT, 0, 0); break;
+                case 'D': tx_key_event_(TxKeyCode_ARROW_LEFT, 0, 0);  break;
+                case 'H': tx_key_event_(TxKeyCode_HOME, 0, 0);        break;
+                case 'F': tx_key_event_(TxKeyCode_END, 0, 0);         break;
+                case 'P': tx_key_event_(TxKeyCode_F1, 0, 0);          break;
+                case 'Q': tx_key_event_(TxKeyCode_F2, 0, 0);          break;
+                case 'R': tx_key_event_(TxKeyCode_F3, 0, 0);          break;
+                case 'S': tx_key_event_(TxKeyCode_F4, 0, 0);          break;
+            }
+            i += 3;
+        } else if (next == 0x1B) {
+            tx_key_event_(TxKeyCode_ESC, 0, 0);
+            i++;
+        } else {
+            // ESC followed by a printable key is how terminals report Alt+key
+            if (next >= 0x20 && next < 0x7F) tx_key_event_(next, 0, TxModifier_ALT);
+            i += 2;
+        }
+    }
+    return i;
 }
 
-static bool tx_get_screen_size_(uint16_t *w, uint16_t *h) {
-    int fd = open("/dev/tty", O_RDWR);
-    if (fd < 0) {
-        tx_error("Failed to open terminal file");
-        return false;
+static int tx_decode_csi_(const uint8_t *buf, int len) {
+    enum { MAX_CSI_LEN = 32 };
+
+    // Parameters and intermediates are 0x20-0x3F, the sequence ends with 0x40-0x7E
+    int end = 2;
+    while (end < len && end < MAX_CSI_LEN && (buf[end] < 0x40 || buf[end] > 0x7E)) {
+        end++;
+    }
+    if (end >= MAX_CSI_LEN) {
+        return end; // Malformed, skip it
+    }
+    if (end >= len) {
+        return 0;
     }
 
-    struct winsize ws;
-    int r = ioctl(fd, TIOCGWINSZ, &ws);
-    if (r < 0) {
-        tx_error("Failed to read size of terminal");
-        close(fd);
-        return false;
+    char params[MAX_CSI_LEN] = {0};
+    memcpy(params, buf + 2, end - 2);
+    char final = (char)buf[end];
+
+    if (params[0] == '<' && (final == 'M' || final == 'm')) {
+        tx_decode_mouse_(params + 1, final);
+        return end + 1;
     }
 
-    *w = ws.ws_col - 1;
-    *h = ws.ws_row - 1;
+    // Reply to the kitty keyboard query: `CSI ? flags u`
+    if (params[0] == '?' && final == 'u') {
+        TX_.kitty_flags = atoi(params + 1);
+        return end + 1;
+    }
 
-    close(fd);
-    return true;
+    // Fields are `key[:shifted[:base]] ; modifiers[:event] ; text`
+    int fields[3][3] = {0};
+    tx_parse_csi_params_(params, fields);
+
+    int         type = fields[1][1];
+    if (type == 0 && (TX_.kitty_flags & TX_KITTY_REPORT_EVENTS_)) {
+        type = 1; // The event type is omitted for presses
+    }
+    TxModifiers mods = fields[1][0] > 0 ? (TxModifiers)((fields[1][0] - 1) & 0x0F) : 0;
+
+    int key = 0;
+    switch (final) {
+        case 'u': key = tx_convert_kitty_keycode_(fields[0][0]); break;
+        case 'A': key = TxKeyCode_ARROW_UP;    break;
+        case 'B': key = TxKeyCode_ARROW_DOWN;  break;
+        case 'C': key = TxKeyCode_ARROW_RIGHT; break;
+        case 'D': key = TxKeyCode_ARROW_LEFT;  break;
+        case 'H': key = TxKeyCode_HOME;        break;
+        case 'F': key = TxKeyCode_END;         break;
+        case 'P': key = TxKeyCode_F1;          break;
+        case 'Q': key = TxKeyCode_F2;          break;
+        case 'S': key = TxKeyCode_F4;          break;
+        case 'Z': key = TxKeyCode_TAB;         break;
+        case '~':
+            switch (fields[0][0]) {
+                case 1:  case 7: key = TxKeyCode_HOME;    break;
+                case 4:  case 8: key = TxKeyCode_END;     break;
+                case 3:          key = TxKeyCode_DELETE;  break;
+                case 5:          key = TxKeyCode_PG_UP;   break;
+                case 6:          key = TxKeyCode_PG_DOWN; break;
+                case 11:         key = TxKeyCode_F1;      break;
+                case 12:         key = TxKeyCode_F2;      break;
+                case 13:         key = TxKeyCode_F3;      break;
+                case 14:         key = TxKeyCode_F4;      break;
+                case 15:         key = TxKeyCode_F5;      break;
+                case 17:         key = TxKeyCode_F6;      break;
+                case 18:         key = TxKeyCode_F7;      break;
+                case 19:         key = TxKeyCode_F8;      break;
+                case 20:         key = TxKeyCode_F9;      break;
+                case 21:         key = TxKeyCode_F10;     break;
+                case 23:         key = TxKeyCode_F11;     break;
+                case 24:         key = TxKeyCode_F12;     break;
+            }
+            break;
+    }
+
+    if (key != 0) {
+        tx_key_event_(key, type, mods);
+    }
+
+    // Kitty reports text along with the key when it can, otherwise printable keys are their text
+    if (final == 'u' && type != 3) {
+        if (fields[2][0] != 0) {
+            for (int i = 0; i < 3 && fields[2][i] != 0; i++) tx_push_text_(fields[2][i]);
+        } else if (!(mods & ~TxModifier_SHIFT)) {
+            int c = (mods & TxModifier_SHIFT) && fields[0][1] ? fields[0][1] : fields[0][0];
+            if (c >= 0x20 && c != 0x7F && (c < 0xE000 || c > 0xF8FF)) tx_push_text_(c);
+        }
+    }
+    return end + 1;
 }
 
-static TxVector tx_round_pos_(TxVector p) {
-    return (TxVector) {
-        roundf(p.x),
-        roundf(p.y),
-        p.z,
-    };
+static void tx_push_text_(uint32_t c) {
+    char buf[5];
+    if (!tx_to_utf8(c, buf) || TX_.text_len + 4 > TX_TEXT_INPUT_SIZE) return;
+
+    int n = (int)strlen(buf);
+    memcpy(TX_.text + TX_.text_len, buf, n + 1);
+    TX_.text_len += n;
 }
 
-static int tx_pos_to_idx_(TxVector p) {
-    int x = (int)roundf(p.x);
-    int y = (int)roundf(p.y);
-    return x + y * TX_.screen_width;
+/// Splits `a:b:c;d:e;f` into up to 3 fields of up to 3 sub-parameters. Missing values stay 0.
+static int tx_parse_csi_params_(const char *params, int fields[3][3]) {
+    int field = 0, sub = 0;
+    for (const char *p = params; *p && field < 3; p++) {
+        if (*p == ';') {
+            field++;
+            sub = 0;
+        } else if (*p == ':') {
+            sub++;
+        } else if (*p >= '0' && *p <= '9' && sub < 3) {
+            fields[field][sub] = fields[field][sub] * 10 + (*p - '0');
+        }
+    }
+    return field + 1;
 }
 
-static void tx_set_cell_(int idx, uint32_t c, float z) {
-    TX_.screen[idx] = c;
-    TX_.depth_buffer[idx] = z;
+static int tx_convert_kitty_keycode_(int code) {
+    switch (code) {
+        case 9:     return TxKeyCode_TAB;
+        case 13:    return TxKeyCode_ENTER;
+        case 27:    return TxKeyCode_ESC;
+        case 127:   return TxKeyCode_BACKSPACE;
+        case 57358: return TxKeyCode_CAPS;
+        case 57409: return TxKeyCode_DECIMAL;
+        case 57410: return TxKeyCode_DIVIDE;
+        case 57411: return '*';
+        case 57412: return TxKeyCode_HYPHEN;
+        case 57413: return TxKeyCode_PLUS;
+        case 57414: return TxKeyCode_ENTER;
+        case 57415: return TxKeyCode_EQUALS;
+        case 57441: return TxKeyCode_LEFT_SHIFT;
+        case 57442: return TxKeyCode_LEFT_CTRL;
+        case 57443: return TxKeyCode_LEFT_OPTION;
+        case 57444: return TxKeyCode_LEFT_CMD;
+        case 57447: return TxKeyCode_RIGHT_SHIFT;
+        case 57448: return TxKeyCode_RIGHT_CTRL;
+        case 57449: return TxKeyCode_RIGHT_OPTION;
+        case 57450: return TxKeyCode_RIGHT_CMD;
+    }
+
+    if (code >= 57399 && code <= 57408) return '0' + (code - 57399);             // Keypad digits
+    if (code >= 57376 && code <= 57383) return TxKeyCode_F13 + (code - 57376);   // F13-F20
+    if (code >= 0x20 && code < 0x7F)    return code;
+
+    return 0;
 }
 
-static int tx_codepoint_length_(uint32_t c) {
-    if (c <= 0x7F) {
-        return 1;
-    } else if (c <= 0x7FF) {
-        return 2;
-    } else if (c <= 0xFFFF) {
-        return 3;
-    } else if (c <= 0x10FFFF) {
-        return 4;
+/// Decodes the parameters of an SGR mouse report: `ESC [ < button ; x ; y (M|m)`
+static void tx_decode_mouse_(const char *params, char final) {
+    int cb = 0, cx = 0, cy = 0;
+    // Malformed reports are ignored; logging would write over the screen
+    if (sscanf(params, "%d;%d;%d", &cb, &cx, &cy) != 3) {
+        return;
+    }
+
+    TxMouseEvent ev = {
+        .mods = ((cb & 0x04) ? TxModifier_SHIFT : 0) |
+                ((cb & 0x08) ? TxModifier_ALT   : 0) |
+                ((cb & 0x10) ? TxModifier_CTRL  : 0),
+        .pos  = {.x = (float)(cx - 1), .y = (float)(cy - 1)},
+    };
+
+    static const TxMouseButton buttons[] = {
+        TxMouseButton_LEFT, TxMouseButton_MIDDLE, TxMouseButton_RIGHT, TxMouseButton_NONE,
+    };
+    ev.button = buttons[cb & 0x03];
+
+    if (cb & 0x40) {
+        static const TxMouseEventKind wheels[] = {
+            TxMouseEventKind_WHEEL_UP,   TxMouseEventKind_WHEEL_DOWN,
+            TxMouseEventKind_WHEEL_LEFT, TxMouseEventKind_WHEEL_RIGHT,
+        };
+        ev.kind   = wheels[cb & 0x03];
+        ev.button = TxMouseButton_NONE;
+    } else if (cb & 0x20) {
+        ev.kind = ev.button == TxMouseButton_NONE ? TxMouseEventKind_MOVE : TxMouseEventKind_DRAG;
+    } else if (final == 'M') {
+        ev.kind = TxMouseEventKind_PRESS;
+        TX_.mouse_buttons |= 1 << ev.button;
     } else {
-        return 0;
+        ev.kind = TxMouseEventKind_RELEASE;
+        TX_.mouse_buttons &= ~(1 << ev.button);
     }
+
+    TX_.mouse_pos = ev.pos;
+    tx_push_mouse_event_(ev);
 }
 
-static void tx_move_cursor_to_origin_(void) {
-    printf("\x1b[H");
+static void tx_push_mouse_event_(TxMouseEvent ev) {
+    bool motion = ev.kind == TxMouseEventKind_MOVE || ev.kind == TxMouseEventKind_DRAG;
+
+    // Only the latest position of a run of identical motion events is worth reporting
+    if (motion && TX_.mouse_event_count > 0) {
+        TxMouseEvent *last = &TX_.mouse_events[TX_.mouse_event_count - 1];
+        if (last->kind == ev.kind && last->button == ev.button && last->mods == ev.mods) {
+            last->pos = ev.pos;
+            return;
+        }
+    }
+
+    if (TX_.mouse_event_count >= TX_MAX_MOUSE_EVENTS) {
+        return;
+    }
+
+    TX_.mouse_events[TX_.mouse_event_count++] = ev;
 }
 
+/// Applies a key event to the key table. `type` is the kitty event type (1 press,
+/// 2 repeat, 3 release) or 0 for legacy input that can't tell presses from repeats.
+static void tx_key_event_(int key, int type, TxModifiers mods) {
+    TX_.modifiers = mods;
+
+#ifdef __APPLE__
+    // The event tap is the source of truth for keys on macOS, presses included
+    (void)key;
+    (void)type;
+#else
+    if (type != 3 && TX_.key_presses[key] < UINT8_MAX) TX_.key_presses[key]++;
+
+    // Only keys that edit text inputs are logged, so a long paste can't crowd them out
+    switch (key) {
+        case TxKeyCode_BACKSPACE:
+        case TxKeyCode_DELETE:
+        case TxKeyCode_ARROW_LEFT:
+        case TxKeyCode_ARROW_RIGHT:
+        case TxKeyCode_HOME:
+        case TxKeyCode_END:
+            if (type != 3 && TX_.key_log_count < TX_MAX_KEY_LOG) {
+                TX_.key_log[TX_.key_log_count++] = (struct TxKeyLogEntry_){(uint16_t)key, (uint16_t)TX_.text_len};
+            }
+            break;
+    }
+
+    TxKeyState state = TX_.keys[key];
+    bool       down  = state & (TxKeyState_PRESSED | TxKeyState_HELD);
+
+    switch (type) {
+        case 0:
+            if (down) {
+                TX_.key_repeating[key] = true;
+            } else {
+                TX_.keys[key]          = TxKeyState_PRESSED;
+                TX_.key_repeating[key] = false;
+            }
+            TX_.key_last_seen[key] = tx_time_now_();
+            break;
+        case 1:
+            if (!down) TX_.keys[key] = TxKeyState_PRESSED;
+            break;
+        case 2:
+            if (!down) TX_.keys[key] = TxKeyState_HELD;
+            break;
+        case 3:
+            // Keep a press from this same frame visible alongside its release
+            TX_.keys[key] = (state & TxKeyState_PRESSED) | TxKeyState_RELEASED;
+            break;
+    }
+#endif
+}
+
+#ifdef __APPLE__
 static TxKeyCode tx_convert_to_keycode(int code) {
 #ifdef _WIN32
     #error "Converting from native keycode to TxKeyCode on Windows not yet supported"
@@ -767,7 +3819,6 @@ static TxKeyCode tx_convert_to_keycode(int code) {
 #endif
 }
 
-#ifdef __APPLE__
 static bool tx_macos_enable_event_tap(void) {
     CGEventMask event_mask = CGEventMaskBit(kCGEventKeyDown) | CGEventMaskBit(kCGEventKeyUp) | CGEventMaskBit(kCGEventFlagsChanged);
 
@@ -806,6 +3857,8 @@ static CGEventRef tx_macos_CGEvent_callback(CGEventTapProxy proxy, CGEventType t
 
     TxKeyCode key = tx_convert_to_keycode((int)code);
 
+    if (type == kCGEventKeyDown && TX_.key_presses[key] < UINT8_MAX) TX_.key_presses[key]++;
+
     if      (type == kCGEventKeyDown)      TX_.keys[key] = TxKeyState_PRESSED;
     else if (type == kCGEventKeyUp)        TX_.keys[key] = TxKeyState_RELEASED;
     else if (type == kCGEventFlagsChanged) tx_dbg("TODO: Handle FlagsChanged event");
@@ -814,6 +3867,712 @@ static CGEventRef tx_macos_CGEvent_callback(CGEventTapProxy proxy, CGEventType t
 }
 #endif // __APPLE__
 
+// +==============================================================================================+
+// | Character Widths                                                                             |
+// +==============================================================================================+
+
+// BEGIN GENERATED CHAR WIDTH TABLE
+// Unicode 14.0.0, regenerate with tools/gen_char_width.py
+static const uint8_t tx_width_stage1_[0x110000 >> 8] = {
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x01, 0x11, 0x01, 0x01, 0x01, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x01, 0x01,
+    0x19, 0x01, 0x01, 0x1A, 0x01, 0x1B, 0x1C, 0x1D, 0x01, 0x01, 0x01, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x28, 0x01, 0x29, 0x01, 0x2A, 0x2B, 0x2C, 0x2D, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x2E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x26, 0x26, 0x2F, 0x01, 0x01, 0x30, 0x31,
+    0x01, 0x32, 0x33, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x35, 0x01, 0x01, 0x36, 0x37, 0x38,
+    0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x01, 0x44, 0x45, 0x46, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x47, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x49, 0x01, 0x01, 0x01, 0x4A,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x4B, 0x26, 0x26, 0x26, 0x26, 0x4C, 0x4D, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4E,
+    0x26, 0x4F, 0x50, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x52,
+    0x01, 0x53, 0x54, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x56, 0x49, 0x57, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x59, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x01, 0x62, 0x63, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x64,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x64,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x65, 0x66, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+static const uint8_t tx_width_stage2_[103 * 64] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x41, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x14, 0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x51,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00, 0x00, 0x01, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54,
+    0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+    0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
+    0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+    0x41, 0x15, 0x14, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x51, 0x55, 0x55,
+    0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+    0x01, 0x10, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,
+    0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
+    0x01, 0x54, 0x55, 0x51, 0x55, 0x41, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x54, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04,
+    0x54, 0x05, 0x04, 0x50, 0x55, 0x41, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
+    0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+    0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x45, 0x55, 0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x40, 0x55,
+    0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x54,
+    0x55, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x40,
+    0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+    0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55,
+    0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
+    0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15, 0x54, 0x55, 0x45, 0x55, 0x01, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x40, 0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x14,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54,
+    0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x55,
+    0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x50, 0x11, 0x50, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0x50, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x04, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x56, 0x96, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+    0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x59, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x69,
+    0x55, 0x5A, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0xA5, 0x59, 0x65, 0x59,
+    0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x66, 0x95, 0x9A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xA0, 0xAA, 0xAA, 0xAA, 0x6A,
+    0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x81, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x56, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55,
+    0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x15, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56,
+    0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x41, 0x41, 0x55, 0x55,
+    0x15, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
+    0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x45, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x5A, 0x55, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+    0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x01, 0x41, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+    0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14, 0x54, 0x55, 0x15,
+    0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x55,
+    0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x54, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55,
+    0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
+    0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0x45,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+    0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x54, 0x00, 0x54, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+    0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
+    0x04, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x10,
+    0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11,
+    0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x05, 0x10, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x44,
+    0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x05, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40,
+    0x55, 0x15, 0x55, 0x55, 0x01, 0x40, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x00, 0x10,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x41, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x45, 0x10,
+    0x00, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x50, 0x11, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x54, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x54, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xA9, 0xAA, 0x69,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x6A, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00,
+    0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55,
+    0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x04, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x65, 0xA9, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x6A, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55,
+    0xAA, 0xAA, 0x56, 0x55, 0x5A, 0x55, 0x55, 0x55, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0xA9, 0xAA, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x6A, 0x95, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x56, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A,
+    0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x96,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A,
+    0x55, 0x55, 0x95, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x5A, 0x55, 0x56, 0x6A, 0xA9, 0x55, 0xA9, 0x55, 0x55, 0x95, 0x56, 0x55, 0xAA, 0xAA, 0x56,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x56, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA,
+    0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x56, 0xAA, 0x56,
+    0xAA, 0x6A, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0xAA, 0xAA, 0x6A, 0x55,
+    0xAA, 0x5A, 0x55, 0x55, 0xAA, 0xAA, 0x5A, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0x6A, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A,
+    0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+};
+// END GENERATED CHAR WIDTH TABLE
+
+int tx_char_width(uint32_t c) {
+    if (c - 0x20 < 0x5F) return 1;
+    if (c >= 0x110000)   return 1;
+
+    // Two bits per character, in blocks of 256 shared between identical ranges
+    uint8_t packed = tx_width_stage2_[tx_width_stage1_[c >> 8] * 64 + ((c & 0xFF) >> 2)];
+    return (packed >> ((c & 3) * 2)) & 3;
+}
+
 #endif // _TEMEX_H_IMPLEMENTATION_
 #endif // TX_IMPLEMENTATION
 
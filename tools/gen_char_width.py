@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Regenerates the character width table in temex.h from Python's Unicode database.
+
+    python3 tools/gen_char_width.py [path/to/temex.h]
+
+Widths are 0 for combining, format and control characters, 2 for East Asian wide and
+fullwidth characters, and 1 for everything else. The table has two levels: the high bits
+of a codepoint select a block of 256 widths, packed four to a byte, and identical blocks
+are shared.
+"""
+
+import sys
+import unicodedata
+
+BEGIN = '// BEGIN GENERATED CHAR WIDTH TABLE\n'
+END   = '// END GENERATED CHAR WIDTH TABLE\n'
+
+# Format characters that are drawn, like the soft hyphen and prepended concatenation marks
+VISIBLE_FORMAT = {
+    0x00AD, 0x0600, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605, 0x06DD, 0x070F,
+    0x0890, 0x0891, 0x08E2, 0x110BD, 0x110CD,
+}
+
+# Unassigned codepoints in these ranges default to wide (see EastAsianWidth.txt)
+WIDE_DEFAULTS = [
+    (0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+    (0x20000, 0x2FFFD), (0x30000, 0x3FFFD),
+]
+
+
+def width(cp):
+    c = chr(cp)
+    cat = unicodedata.category(c)
+    if cp == 0:
+        return 0
+    if cat in ('Mn', 'Me', 'Cc') or (cat == 'Cf' and cp not in VISIBLE_FORMAT):
+        return 0
+    if 0x1160 <= cp <= 0x11FF or cp == 0x200B:
+        return 0  # Hangul medial vowels and final consonants join the previous syllable
+    if cat == 'Cn':
+        return 2 if any(lo <= cp <= hi for lo, hi in WIDE_DEFAULTS) else 1
+    if unicodedata.east_asian_width(c) in ('W', 'F'):
+        return 2
+    return 1
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else 'temex.h'
+
+    blocks, stage1, stage2 = {}, [], []
+    for hi in range(0x110000 >> 8):
+        packed = bytearray(64)
+        for lo in range(256):
+            packed[lo >> 2] |= width(hi << 8 | lo) << ((lo & 3) * 2)
+        packed = bytes(packed)
+        if packed not in blocks:
+            blocks[packed] = len(blocks)
+            stage2.append(packed)
+        stage1.append(blocks[packed])
+    assert len(blocks) <= 256
+
+    def rows(data, per_row):
+        for i in range(0, len(data), per_row):
+            yield '    ' + ' '.join('0x%02X,' % b for b in data[i:i + per_row]) + '\n'
+
+    out = [BEGIN]
+    out.append('// Unicode %s, regenerate with tools/gen_char_width.py\n' % unicodedata.unidata_version)
+    out.append('static const uint8_t tx_width_stage1_[0x110000 >> 8] = {\n')
+    out += rows(stage1, 16)
+    out.append('};\n\n')
+    out.append('static const uint8_t tx_width_stage2_[%d * 64] = {\n' % len(stage2))
+    out += rows(b''.join(stage2), 16)
+    out.append('};\n')
+    out.append(END)
+
+    with open(path) as f:
+        src = f.read()
+    start, stop = src.index(BEGIN), src.index(END) + len(END)
+    with open(path, 'w') as f:
+        f.write(src[:start] + ''.join(out) + src[stop:])
+
+
+if __name__ == '__main__':
+    main()